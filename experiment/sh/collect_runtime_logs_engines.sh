@@ -0,0 +1,44 @@
+#!/bin/bash
+# Collect cumulative evolution and total execution times of Game of Life (GoL)'s binary for every evolution engine.
+#
+# Please note - A: Execute this file with its folder as the CWD.
+# Please note - B: Engines are compared on a serial binary, so that their speedup is not biased by parallelism.
+# Please note - C: GoL boards are assumed to be square, unless otherwise stated.
+# Please note - D: GoL_LOG's guard is required in compilation to enable logging functions.
+#
+
+BOARD_DIMENS=(100 500 1000 5000 10000)
+ENGINES=(naive bitpack padded simd lut colsum tiled hashlife sparse auto temporal)
+
+best_opt_level=2
+
+# I/O variables
+binname="GoL_engines"
+
+srcfile="../../src/cpu/gol.c"
+
+binfile="../../bin/${binname}"
+outfile="${binname}.out"
+
+# Metadata variables
+init_prob=0.5
+seed=1
+tsteps=100
+reps=1
+
+# Compile a GoL binary right before running the experiments, without -xHost as the SIMD engine picks its kernels at runtime
+icc -O$best_opt_level -DGoL_LOG -ipo $srcfile -o $binfile
+
+for (( rep=0; rep<$reps; ++rep ));
+do
+    for size in "${BOARD_DIMENS[@]}"
+    do
+        nrows=$size
+        ncols=$size
+
+        for engine in "${ENGINES[@]}"
+        do
+            ./$binfile -c $ncols -r $nrows -t $tsteps -o $outfile --seed $seed -p $init_prob -e $engine
+        done
+    done
+done
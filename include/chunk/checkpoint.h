@@ -0,0 +1,135 @@
+#ifndef GoL_CHUNK_CHECKPOINT_H
+#define GoL_CHUNK_CHECKPOINT_H
+
+#include <mpi.h> // Enable MPI support
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+// Custom includes
+#include "chunk.h"
+#include "../life/checkpoint.h"
+#include "../utils/board.h"
+#include "../utils/pack.h"
+
+/*
+ * MPI processes write their checkpoints in the same binary format as a single process does, with collective MPI-IO in the
+ * background: every process packs its own block into whole rows of the board, the processes of a band OR their rows into the
+ * leftmost one of the band, unless the grid has a single column, and the leftmost processes write their rows at their offset within
+ * the file via MPI_File_iwrite_at_all, while evolution goes on. As every block can be read on its own from the file, a checkpoint
+ * can be restarted from with any number of processes, and any grid of them.
+ */
+
+/**
+ * Wait until the previous checkpoint, if any, has been written, and let it replace the one before.
+ */
+void wait_chunk_checkpoint(chunk_t *chunk, char *outfile) {
+    if (chunk->ckpt_data == NULL)
+        return;
+
+    MPI_Wait(&chunk->ckpt_request, MPI_STATUS_IGNORE);
+    MPI_File_close(&chunk->ckpt_file);
+
+    free(chunk->ckpt_data);
+    chunk->ckpt_data = NULL;
+
+    if (chunk->rank == 0) {
+        char *path      = checkpoint_path(outfile, false);
+        char *temp_path = checkpoint_path(outfile, true);
+
+        if (rename(temp_path, path) != 0) {
+            perror("[*] Failed to write the checkpoint file.");
+            MPI_Abort(MPI_COMM_WORLD, 1);
+        }
+
+        free(path);
+        free(temp_path);
+    }
+
+    // No process opens the temporary file again before it has been renamed
+    MPI_Barrier(chunk->comm);
+}
+
+/**
+ * Start writing the checkpoint of GoL's board at the given generation, in the background, once the previous one has been written.
+ * All processes have to call it at once.
+ */
+void save_chunk_checkpoint(chunk_t *chunk, life_t life, int generation) {
+    int i;
+    int status; // All MPI routines in C return an int error value
+
+    int nrows = chunk->nrows;
+    int ncols = chunk->ncols;
+
+    size_t row_words    = board_row_words(chunk->tot_cols);
+    size_t header_words = sizeof(board_header_t) / sizeof(uint64_t);
+
+    // Whether the calling process writes the rows of its band
+    bool writer = chunk->coords[1] == 0;
+
+    wait_chunk_checkpoint(chunk, life.outfile);
+
+    // 1. Pack the block into whole rows of the board, right after the header
+    chunk->ckpt_data = (uint64_t *) calloc(header_words + nrows * row_words, sizeof(uint64_t));
+
+    if (chunk->ckpt_data == NULL) {
+        perror("[*] Failed to allocate the checkpoint.");
+        MPI_Abort(MPI_COMM_WORLD, 1);
+    }
+
+    uint64_t *rows = chunk->ckpt_data + header_words;
+
+    #ifdef _OPENMP
+    #pragma omp parallel for
+    #endif
+    for (i = 0; i < nrows; i++)
+        pack_row_at(chunk->slice[i + chunk->ghost], ncols, rows + row_words * i, chunk->col0);
+
+    // 2. Merge the blocks of the band into its leftmost process
+    if (chunk->dims[1] > 1) {
+        MPI_Comm band;
+
+        MPI_Comm_split(chunk->comm, chunk->coords[0], chunk->coords[1], &band);
+
+        MPI_Reduce(writer ? MPI_IN_PLACE : rows, rows, (int) (nrows * row_words),
+                   MPI_UINT64_T, MPI_BOR, 0, band);
+
+        MPI_Comm_free(&band);
+    }
+
+    // 3. Write the rows of every band at their offset, and the header on rank 0, which owns the top rows
+    board_header_t header;
+
+    init_board_header(&header, chunk->tot_rows, chunk->tot_cols, generation, life.seed);
+    memcpy(chunk->ckpt_data, &header, sizeof(board_header_t));
+
+    char *temp_path = checkpoint_path(life.outfile, true);
+
+    status = MPI_File_open(chunk->comm, temp_path, MPI_MODE_CREATE | MPI_MODE_WRONLY,
+                           MPI_INFO_NULL, &chunk->ckpt_file);
+
+    free(temp_path);
+
+    if (status != MPI_SUCCESS) {
+        fprintf(stderr, "[*] Failed to open the checkpoint file - errcode %d", status);
+        MPI_Abort(MPI_COMM_WORLD, 1);
+    }
+
+    // Any leftover of a checkpoint that did not complete
+    MPI_File_set_size(chunk->ckpt_file, 0);
+
+    MPI_Offset offset = (MPI_Offset) (header_words + chunk->row0 * row_words) * sizeof(uint64_t);
+
+    uint64_t *data = chunk->rank == 0 ? chunk->ckpt_data : rows;
+    int count      = !writer ? 0 : (int) (nrows * row_words + (chunk->rank == 0 ? header_words : 0));
+
+    status = MPI_File_iwrite_at_all(chunk->ckpt_file, chunk->rank == 0 ? 0 : offset, data, count,
+                                    MPI_UINT64_T, &chunk->ckpt_request);
+
+    if (status != MPI_SUCCESS) {
+        fprintf(stderr, "[*] Failed to write the checkpoint file - errcode %d", status);
+        MPI_Abort(MPI_COMM_WORLD, 1);
+    }
+}
+
+#endif
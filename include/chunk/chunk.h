@@ -2,25 +2,93 @@
 #define GoL_CHUNK_H
 
 #include <mpi.h> // Enable MPI support
+#include <stdint.h>
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 #include <unistd.h>
 
 // Custom includes
 #include "../globals.h"
 #include "../life/life.h"
+#include "wire.h"
+
+/**
+ * Times spent in each phase of GoL evolution, see enum Phases, reduced across all MPI processes.
+ */
+typedef struct timings {
+    double min[NUM_PHASES]; // Minimum time across processes in ms
+    double avg[NUM_PHASES]; // Average time across processes in ms
+    double max[NUM_PHASES]; // Maximum time across processes in ms
+} timings_t;
+
+/**
+ * Evaluate the load imbalance of a phase, i.e., how much longer the slowest process took than the average one.
+ *
+ * @return imbalance    max / avg - 1, as a percentage.
+ */
+double imbalance(timings_t timings, int phase) {
+    return timings.avg[phase] > 0. \
+            ? (timings.max[phase] / timings.avg[phase] - 1.) * 100. : 0.;
+}
 
 /**
  * All the data required by a single communicating process via MPI.
+ *
+ * Processes are arranged in a periodic 2D grid, as GoL's board is toroidal, and each of them owns a block of the board,
+ * surrounded by a ring of ghost cells that mirror the borders of its 8 neighbour blocks. On a grid of a single column, the ring
+ * can be several rows deep, as explained in game_chunk(), and the rows can move from one process to another, as explained in
+ * rebalance_chunk().
  */ 
 typedef struct chunk {
     int nrows;         // Number of rows in the slice w/o ghost rows
-    int ncols;         // Number of columns in the slice
+    int ncols;         // Number of columns in the slice w/o ghost columns
     int rank;          // Rank of the calling MPI process in the communicator
     int size;          // Number of total MPI processes present in the communicator
-    int displacement;  // Number of leftover rows assigned to the last process
-
-    bool **slice;      // Chunk's slice of data at the current step
-    bool **next_slice; // Chunk's slice of data at the next step
+    int engine;        // Evolution engine in use, see enum Engines
+    int output;        // How the board is written to file, see enum Outputs
+
+    int tot_rows;      // Number of rows in GoL's whole board
+    int tot_cols;      // Number of columns in GoL's whole board
+    int row0;          // # of the top row of the slice in GoL's whole board
+    int col0;          // # of the leftmost column of the slice in GoL's whole board
+
+    MPI_Comm comm;     // Cartesian communicator of the 2D grid of processes
+    int dims[2];       // Number of processes along the rows and the columns of the grid
+    int coords[2];     // Coordinates of the calling process in the grid
+    int neighbs[3][3]; // Ranks of the neighbour processes, e.g., [0][1] the top one and [2][2] the bottom-right one
+
+    int ghost;         // Number of ghost rows on either side, i.e., the depth of the halo exchanged every ghost generations
+    int rebalance;     // Number of generations between checks of the load balance, or 0 to never check it
+    int *row_starts;   // # of the top row of every band of processes, i.e., row of the grid, and tot_rows, dims[0] + 1 in all
+
+    int exchange;          // How ghost rows are exchanged, see enum Exchanges
+    MPI_Comm node_comm;    // Processes on the same node as the calling one, only with EXCHANGE_SHARED
+    MPI_Win window;        // Shared memory window of node_comm, whose segments hold the counters and both slices of each process
+    int node_neighbs[2];   // Ranks in node_comm of the top and bottom neighbours, or MPI_UNDEFINED if they are on another node
+    int blocks;            // # of blocks of generations completed, i.e., of exchanges of the halo
+
+    int wire;               // How rows go on the wire in ghost row and gather messages, see enum Wires
+    uint64_t *wire_send[2]; // Top and bottom borders packed on the wire, only with WIRE_PACKED
+    uint64_t *wire_recv[2]; // Top and bottom ghost rows packed on the wire, only with WIRE_PACKED
+
+    int checkpoint;           // Number of generations between checkpoints of the board, or 0 to never write them
+    MPI_File ckpt_file;       // Checkpoint being written in the background, if any
+    MPI_Request ckpt_request; // Write of the checkpoint in the background
+    uint64_t *ckpt_data;      // Header and packed rows of the checkpoint being written, or NULL if none is
+
+    writer_t writer;       // Writer of the output file, only opened on rank 0 with OUTPUT_GATHER; its counters are set on all processes
+    MPI_File out_file;     // Output file, kept open for the whole run with OUTPUT_COLLECTIVE, or MPI_FILE_NULL if not open yet
+    MPI_Offset out_end;    // End of the last board written to the output file, with OUTPUT_COLLECTIVE
+    int dump;              // Number of generations between dumps of large boards, or 0 to only dump the initial and final ones
+
+    MPI_Datatype col_type;  // One column of the slice, w/o ghost rows, as rows are not contiguous in memory
+    MPI_Datatype halo_type; // ghost rows of the slice, w/o ghost columns
+
+    bool **slice;      // Chunk's slice of data at the current step, ghost cells included
+    bool **next_slice; // Chunk's slice of data at the next step, ghost cells included
+
+    timings_t timings; // Phase times of GoL evolution across all processes, only set on rank 0
 } chunk_t;
 
 /***********************
@@ -28,13 +96,22 @@ typedef struct chunk {
  ***********************/
 
 void initialize_chunk(chunk_t *chunk, life_t life,
-        FILE *input_ptr, int from, int to);
+        FILE *input_ptr);
 
 double game_chunk(chunk_t *chunk, life_t life);
-void evolve_chunk(chunk_t *chunk);
+void evolve_chunk(chunk_t *chunk, int from, int to);
 
 void cleanup_chunk(chunk_t *chunk);
 
+/**
+ * Split n rows/columns as evenly as possible among p processes.
+ *
+ * @return start    The # of the first row/column that belongs to the process at coordinate c, or n if c == p.
+ */
+int chunk_start(int n, int p, int c) {
+    return (int) ((long long) n * c / p);
+}
+
 /***********************
  * Debugging functions *
  ***********************/
@@ -47,7 +124,10 @@ void debug_chunk(chunk_t chunk) {
     printf("Number of cols: %d\n", chunk.ncols);
     printf("Number of rows: %d\n", chunk.nrows);
     printf("Communicator size: %d\n", chunk.size);
-    printf("Number of leftover rows: %d\n\n", chunk.displacement);
+    printf("Grid of processes: %dx%d\n", chunk.dims[0], chunk.dims[1]);
+    printf("Coordinates in the grid: (%d, %d)\n", chunk.coords[0], chunk.coords[1]);
+    printf("Top-left cell: (%d, %d)\n", chunk.row0, chunk.col0);
+    printf("Number of ghost rows on either side: %d\n\n", chunk.ghost);
 
     fflush(stdout);
 }
@@ -58,21 +138,14 @@ void debug_chunk(chunk_t chunk) {
  *********************/
 
 /**
- * Print the slice of GoL data assigned to the calling process to console.
+ * Print a band of whole rows of GoL's board, gathered by the calling process, to console.
  */
-void show_chunk(chunk_t chunk) {
+void show_buffer(int ncols, int nrows, bool *buffer) {
     int i, j;
 
-    int ncols = chunk.ncols;
-    int nrows = chunk.nrows;
-
-    // \033[H: Move cursor to top-left corner;
-    // \033[J: Clear console.
-    printf("\033[H\033[J");
-
-    for (i = 1; i < nrows + 1; i++) { // Skip top/bottom ghost rows
+    for (i = 0; i < nrows; i++) {
         for (j = 0; j < ncols; j++)
-            printf(chunk.slice[i][j] == ALIVE
+            printf(*((buffer + i*ncols) + j) == ALIVE
                     ? "\033[07m  \033[m" : "  ");
 
         printf("\033[E");
@@ -80,179 +153,345 @@ void show_chunk(chunk_t chunk) {
 }
 
 /**
- * Print the buffer of GoL data received by the calling process to console.
- * 
- * @param nrows     The number of rows to read from the buffer. Indeed in case of displacement, that is, the data load not being shared equally
- *                  between the available MPI processes, the buffer will always be allocated as the largest chunk of data across said processes.
- *                  If a sender process manages a slimmer slice of GoL data, the calling process will print the proper amount of the buffer.
+ * Print a band of whole rows of GoL's board, gathered by the calling process, to file. Since this function will be called by one process
+ * only (i.e., rank 0), we can assume beforehand that the data will always have to be appended to file, and the writer is flushed once
+ * the bottom band has been printed to file.
  * 
- * @param buffer    The buffer of data sent by another process via MPI.
+ * @param last    Whether the band is the bottom one of GoL's board, after which a separator has to be printed.
  */
-void show_buffer(int ncols, int nrows, bool *buffer) {
-    int i, j;
+void print_buffer(bool *buffer, int ncols, int nrows, bool last,
+        writer_t *writer) {
+    int i;
 
-    for (i = 0; i < nrows; i++) {
-        for (j = 0; j < ncols; j++)
-            printf(*((buffer + i*ncols) + j) == ALIVE
-                    ? "\033[07m  \033[m" : "  ");
+    for (i = 0; i < nrows; i++)
+        write_row(writer, buffer + (size_t) i*ncols, ncols);
 
-        printf("\033[E");
-    }
+    if (last)
+        end_board(writer);
 }
 
 /**
- * Print the slice of GoL data assigned to the calling process to file.
+ * Set the view of a file that holds GoL's board in text format, from the given offset on, to the calling process' block. As every
+ * row of the board takes tot_cols characters and a newline, the board is a tot_rows x (tot_cols + 1) matrix of characters, and the
+ * block is a subarray of it, newlines included if it is a rightmost one.
  * 
- * @param tot_rows    The overall number of rows in GoL's grid.
+ * @return width    The number of characters per row of the block.
+ */
+int set_chunk_view(chunk_t *chunk, MPI_File file, MPI_Offset start) {
+    int width = chunk->ncols + (chunk->col0 + chunk->ncols == chunk->tot_cols);
+
+    int sizes[2]    = {chunk->tot_rows, chunk->tot_cols + 1};
+    int subsizes[2] = {chunk->nrows, width};
+    int starts[2]   = {chunk->row0, chunk->col0};
+
+    MPI_Datatype block_type;
+
+    MPI_Type_create_subarray(2, sizes, subsizes, starts,
+                             MPI_ORDER_C, MPI_CHAR, &block_type);
+    MPI_Type_commit(&block_type);
+
+    MPI_File_set_view(file, start, MPI_CHAR, block_type, "native", MPI_INFO_NULL);
+
+    // The view holds a reference of its own to the datatype
+    MPI_Type_free(&block_type);
+
+    return width;
+}
+
+/**
+ * Write the current GoL board to file with collective MPI-IO, in the same format as print_buffer(): every process formats its own
+ * block, via format_cells(), and writes it at its place within the board, via set_chunk_view(). Rank 0 also writes the board
+ * dimensions and the separator. The file is kept open for the whole run, and closed by cleanup_chunk().
  * 
- * @param append      Whether to append to or to overwrite the output file.
+ * @param append    Whether to append to or to overwrite the output file.
  */
-void print_chunk(chunk_t chunk, int tot_rows, char *outfile, bool append) {
-    char *mode = append ? "a" : "w";
+void write_chunk(chunk_t *chunk, char *outfile, bool append) {
+    int i;
+    int status; // All MPI routines in C return an int error value
 
-    int i, j;
+    int nrows    = chunk->nrows;
+    int ncols    = chunk->ncols;
+    int tot_rows = chunk->tot_rows;
+    int tot_cols = chunk->tot_cols;
+
+    const char *separator = "****************************************************************************************************\n";
+
+    char header[32];
+    int header_len = append ? 0 : sprintf(header, "%d %d\n", tot_rows, tot_cols);
+
+    MPI_Offset start; // Offset of the board within the file
+
+    double begin = MPI_Wtime();
+
+    // 1. Open the file, unless appending to it, and find where the board starts
+    if (append && chunk->out_file != MPI_FILE_NULL) {
+        start = chunk->out_end;
+    } else {
+        if (chunk->out_file != MPI_FILE_NULL)
+            MPI_File_close(&chunk->out_file);
 
-    int nrows = chunk.nrows;
-    int ncols = chunk.ncols;
+        status = MPI_File_open(chunk->comm, outfile, MPI_MODE_CREATE | MPI_MODE_WRONLY,
+                               MPI_INFO_NULL, &chunk->out_file);
 
-    FILE *out_ptr;
+        if (status != MPI_SUCCESS) {
+            fprintf(stderr, "[*] Failed to open the output file - errcode %d", status);
+            MPI_Abort(MPI_COMM_WORLD, 1); // Any process in the comm has to stop
+        }
 
-    if ((out_ptr = fopen(outfile, mode)) == NULL) {
-        perror("[*] Failed to open the output file.");
-        MPI_Abort(MPI_COMM_WORLD, 1); // Any process in the comm has to stop
+        if (append) {
+            MPI_File_get_size(chunk->out_file, &start);
+        } else {
+            MPI_File_set_size(chunk->out_file, 0);
+            start = 0;
+        }
+    }
+
+    MPI_File file = chunk->out_file;
+
+    if (chunk->rank == 0 && header_len > 0)
+        MPI_File_write_at(file, start, header, header_len, MPI_CHAR, MPI_STATUS_IGNORE);
+
+    start += header_len;
+
+    // Characters per row of the block, the newline included for the rightmost blocks
+    int width = set_chunk_view(chunk, file, start);
+
+    // 2. Format the block
+    char *block = (char *) malloc((size_t) nrows * width);
+
+    if (block == NULL) {
+        perror("[*] Failed to allocate the output block.");
+        MPI_Abort(MPI_COMM_WORLD, 1);
     }
 
-    if (!append) // Print board dimensions only once
-        fprintf(out_ptr, "%d %d\n", tot_rows, ncols);
-        
     for (i = 0; i < nrows; i++) {
-        for (j = 0; j < ncols; j++)
-            fprintf(out_ptr, "%c", chunk.slice[i][j] == ALIVE
-                    ? 'X' : ' ');
+        bool *row  = chunk->slice[i + chunk->ghost];
+        char *line = block + (size_t) i * width;
+
+        format_cells(row, ncols, line);
 
-        fprintf(out_ptr, "\n");
+        if (width > ncols)
+            line[ncols] = '\n';
     }
 
-    fflush(out_ptr);
-    fclose(out_ptr);
+    // 3. Write the block at its place within the board, together with all other processes
+    status = MPI_File_write_at_all(file, 0, block, nrows * width, MPI_CHAR, MPI_STATUS_IGNORE);
+
+    if (status != MPI_SUCCESS) {
+        fprintf(stderr, "[*] Failed to write to the output file - errcode %d", status);
+        MPI_Abort(MPI_COMM_WORLD, 1);
+    }
+
+    // 4. Close the board with the separator
+    MPI_File_set_view(file, 0, MPI_CHAR, MPI_CHAR, "native", MPI_INFO_NULL);
+
+    if (chunk->rank == 0)
+        MPI_File_write_at(file, start + (MPI_Offset) tot_rows * (tot_cols + 1),
+                          separator, strlen(separator), MPI_CHAR, MPI_STATUS_IGNORE);
+
+    chunk->out_end = start + (MPI_Offset) tot_rows * (tot_cols + 1) + strlen(separator);
+
+    free(block);
+
+    // Rank 0 also accounts for the dimensions and the separator
+    chunk->writer.bytes += (double) nrows * width \
+            + (chunk->rank == 0 ? header_len + strlen(separator) : 0);
+    chunk->writer.time  += (MPI_Wtime() - begin) * 1e3;
 }
 
 /**
- * Print the buffer of GoL data received by the calling process to file. Since this function will be called by one process only (i.e., rank 0),
- * we can assume beforehand that the data will always have to be appended to file and we will let the calling process take care of closing
- * the file pointer once all buffers received via MPI have been printed to file. 
- * 
- * @param buffer       The buffer of data sent by another process via MPI.
- *    
- * @param nrows        The number of rows to read from the buffer. Indeed in case of displacement, that is, the data load not being shared equally
- *                     between the available MPI processes, the buffer will always be allocated as the largest chunk of data across said processes.
- *                     If a sender process manages a slimmer slice of GoL data, the calling process will print the proper amount of the buffer.
- *    
- * @param rank         The rank of the sender process in the MPI communicator.
- * 
- * @param comm_size    The overall number of MPI processes present in the communicator.
+ * Allocate the buffers rank 0 gathers GoL's board into, one band of processes at a time, i.e., a buffer as large as the tallest band
+ * and, if packed, a buffer as large as the largest block on the wire, no wider than tot_cols / dims[1] rounded up.
+ *
+ * @return band    The band buffer.
  */
-void print_buffer(bool *buffer, int ncols, int nrows, int rank,
-        int comm_size, FILE* out_ptr) {
-    int i, j;
+bool* malloc_band(chunk_t *chunk, uint64_t **wire, int *max_words) {
+    int pr;
 
-    // Check if the sender process is the last one in the MPI communicator...
-    bool last = (rank == comm_size - 1);
+    int max_rows = 0;
 
-    for (i = 0; i < nrows; i++) {
-        for (j = 0; j < ncols; j++)
-            fprintf(out_ptr, "%c", *((buffer + i*ncols) + j) == ALIVE
-                    ? 'X' : ' ');
+    for (pr = 0; pr < chunk->dims[0]; pr++)
+        if (chunk->row_starts[pr + 1] - chunk->row_starts[pr] > max_rows)
+            max_rows = chunk->row_starts[pr + 1] - chunk->row_starts[pr];
+
+    bool *band = (bool *) malloc(sizeof(bool) * chunk->tot_cols * max_rows);
+
+    *max_words = (int) wire_words(max_rows, (chunk->tot_cols + chunk->dims[1] - 1) / chunk->dims[1]);
 
-        fprintf(out_ptr, "\n");
+    *wire = chunk->wire == WIRE_PACKED \
+            ? (uint64_t *) malloc(sizeof(uint64_t) * *max_words) : NULL;
+
+    if (band == NULL || (chunk->wire == WIRE_PACKED && *wire == NULL)) {
+        perror("[*] Failed to allocate the band buffer.");
+        MPI_Abort(MPI_COMM_WORLD, 1);
     }
 
-    if (last) // ...because in that case it will have to print a separator to file.
-        fprintf(out_ptr, "****************************************************************************************************\n");
+    return band;
 }
 
 /**
- * Print the current GoL board to either console or file depending on whether its size is larger than DEFAULT_MAX_SIZE. Only one process
- * within the MPI communicator is allowed to perform printing operations (i.e., rank 0). It will print its own chuck of GoL data, and then
- * wait for all the other processes to send theirs sequentially in buffers. This procedure ensures to restore the proper order of
- * the overall GoL's grid, since the data was originaly split sequentially in chunks between all MPI processes.
- * 
- * @param big         Whether GoL's grid is larger than DEFAULT_MAX_SIZE.
- * 
- * @param tot_rows    The overall number of rows in GoL's grid.
- * 
- * @param append      Whether to append to or to overwrite the output file, if in use.
+ * Gather the pr-th band of processes into whole rows of GoL's board, on rank 0, by receiving each block straight into its place within
+ * the band, via the buffers of malloc_band(). All other processes of the band send their block via send_block().
  */
-void display_chunk(chunk_t *chunk, bool big, int tot_rows,
-        char *outfile, bool append) {
+void gather_band(chunk_t *chunk, int pr, bool *band, uint64_t *wire, int max_words) {
+    int pc, i;
     int status; // All MPI routines in C return an int error value
 
-    if (chunk->rank == 0) {
-        int r, j, k;
-
-        // 1. Print its chunk to console/file
-        if (!big)
-            show_chunk(*chunk);
-        else
-            print_chunk(*chunk, tot_rows, outfile, append);
-
-        int nrows = chunk->nrows;
-        int ncols = chunk->ncols;
+    int tot_cols = chunk->tot_cols;
+    int brows    = chunk->row_starts[pr + 1] - chunk->row_starts[pr];
 
-        // 2. Statically allocate the buffer as a 2D matrix in order to guarantee its continuity in memory. This ensures that the whole
-        // slice of GoL data a process sends could be received with a single MPI_Recv call.
-        bool buffer[nrows + chunk->displacement][ncols];
+    for (pc = 0; pc < chunk->dims[1]; pc++) {
+        int coords[2] = {pr, pc};
+        int r;
 
-        for (j = 0; j < nrows + chunk->displacement; j++)
-            for(k = 0; k < ncols; k++)
-                buffer[j][k] = DEAD;
+        int col0  = chunk_start(tot_cols, chunk->dims[1], pc);
+        int bcols = chunk_start(tot_cols, chunk->dims[1], pc + 1) - col0;
 
-        FILE *out_ptr;
+        MPI_Cart_rank(chunk->comm, coords, &r);
 
-        if (big)
-            if ((out_ptr = fopen(outfile, "a")) == NULL) {
-                perror("[*] Failed to open the output file.");
-                MPI_Abort(MPI_COMM_WORLD, 1);
-            }
+        if (r == 0) {
+            for (i = 0; i < brows; i++)
+                memcpy(band + i*tot_cols + col0, chunk->slice[i + chunk->ghost], bcols);
 
-        MPI_Status mstatus; // Required as a MPI_Recv argument, but never used
+            continue;
+        }
 
-        // 3. Collect and print other processes'
-        for (r = 1; r < chunk->size; r++) {
-            status = MPI_Recv(&buffer[0][0], (nrows + chunk->displacement) * ncols,
-                              MPI_C_BOOL, r, PRINT, MPI_COMM_WORLD, &mstatus);
+        // Receive the block on the wire, and unpack it into its columns of the band...
+        if (chunk->wire == WIRE_PACKED) {
+            status = MPI_Recv(wire, max_words, MPI_UINT64_T,
+                              r, PRINT, chunk->comm, MPI_STATUS_IGNORE);
 
             if (status != MPI_SUCCESS) {
                 fprintf(stderr, "[*] Failed to receive data from process %d - errcode %d", r, status);
                 MPI_Abort(MPI_COMM_WORLD, 1);
             }
 
-            // Account for displacement if last rank process
-            int rrows = (r == chunk->size - 1) \
-                        ? nrows + chunk->displacement : nrows;
+            unpack_rows(wire, band + col0, tot_cols, brows, bcols);
+            continue;
+        }
+
+        // ...or straight into its columns of the band
+        MPI_Datatype block_type;
+
+        MPI_Type_vector(brows, bcols, tot_cols, MPI_C_BOOL, &block_type);
+        MPI_Type_commit(&block_type);
+
+        status = MPI_Recv(band + col0, 1, block_type,
+                          r, PRINT, chunk->comm, MPI_STATUS_IGNORE);
+
+        MPI_Type_free(&block_type);
+
+        if (status != MPI_SUCCESS) {
+            fprintf(stderr, "[*] Failed to receive data from process %d - errcode %d", r, status);
+            MPI_Abort(MPI_COMM_WORLD, 1);
+        }
+    }
+}
+
+/**
+ * Send the calling process' block to rank 0, which gathers it via gather_band().
+ */
+void send_block(chunk_t *chunk) {
+    int status; // All MPI routines in C return an int error value
+
+    if (chunk->wire == WIRE_PACKED) {
+        uint64_t *wire = (uint64_t *) malloc(sizeof(uint64_t) * wire_words(chunk->nrows, chunk->ncols));
+
+        if (wire == NULL) {
+            perror("[*] Failed to allocate the block on the wire.");
+            MPI_Abort(MPI_COMM_WORLD, 1);
+        }
+
+        int count = pack_rows(chunk->slice[chunk->ghost], chunk->slice[1] - chunk->slice[0],
+                              chunk->nrows, chunk->ncols, wire);
+
+        status = MPI_Send(wire, count, MPI_UINT64_T, 0, PRINT, chunk->comm);
+
+        free(wire);
+    } else {
+        // Rows are padded with ghost columns, thus they are not contiguous in memory: describe them
+        // with a strided datatype, so that the whole slice can still be sent with a single MPI_Send call
+        MPI_Datatype rows_type;
+
+        MPI_Type_vector(chunk->nrows, chunk->ncols, chunk->slice[1] - chunk->slice[0],
+                        MPI_C_BOOL, &rows_type);
+        MPI_Type_commit(&rows_type);
+
+        status = MPI_Send(&chunk->slice[chunk->ghost][0], 1, rows_type,
+                          0, PRINT, chunk->comm); // Start from the 1st non-ghost row for nrows rows
+                                                  // to skip both top and bottom ghost rows
+
+        MPI_Type_free(&rows_type);
+    }
+
+    if (status != MPI_SUCCESS) {
+        fprintf(stderr, "[*] Failed to send data to process 0 - errcode %d", status);
+        MPI_Abort(MPI_COMM_WORLD, 1);
+    }
+}
+
+/**
+ * Print the current GoL board to either console or file depending on whether its size is larger than DEFAULT_MAX_SIZE. Only one process
+ * within the MPI communicator is allowed to perform printing operations (i.e., rank 0). It will gather the board one band of processes
+ * at a time, i.e., one row of the grid of processes, via gather_band(), and print the band before moving on to the next one. This
+ * restores the proper order of the overall GoL's grid, while keeping only a band in memory.
+ *
+ * Large boards are rather written by all processes at once with write_chunk(), unless the gather output is requested.
+ * 
+ * @param big       Whether GoL's grid is larger than DEFAULT_MAX_SIZE.
+ * 
+ * @param append    Whether to append to or to overwrite the output file, if in use.
+ */
+void display_chunk(chunk_t *chunk, bool big,
+        char *outfile, bool append) {
+    if (big && chunk->output == OUTPUT_COLLECTIVE) {
+        write_chunk(chunk, outfile, append);
+        return;
+    }
+
+    if (chunk->rank == 0) {
+        int pr;
+
+        int tot_rows = chunk->tot_rows;
+        int tot_cols = chunk->tot_cols;
+
+        double begin = MPI_Wtime();
+
+        // 1. Clear the console, or print board dimensions only once to file
+        if (!big) {
+            printf("\033[H\033[J");
+        } else {
+            begin_board(&chunk->writer, outfile, tot_rows, tot_cols, append);
+        }
+
+        // 2. Allocate the band buffers
+        uint64_t *wire;
+        int max_words;
+
+        bool *band = malloc_band(chunk, &wire, &max_words);
+
+        // 3. Collect and print the bands, one after the other
+        for (pr = 0; pr < chunk->dims[0]; pr++) {
+            int brows = chunk->row_starts[pr + 1] - chunk->row_starts[pr];
+
+            gather_band(chunk, pr, band, wire, max_words);
 
             if (!big)
-                show_buffer(ncols, rrows, &buffer[0][0]);
+                show_buffer(tot_cols, brows, band);
             else
-                print_buffer(&buffer[0][0], ncols, rrows, r,
-                             chunk->size, out_ptr);
+                print_buffer(band, tot_cols, brows,
+                             pr == chunk->dims[0] - 1, &chunk->writer);
         }
 
+        free(band);
+        free(wire);
+
         if (!big)
             fflush(stdout);
-        else {
-            fflush(out_ptr);
-            fclose(out_ptr);
-        }
+        else
+            chunk->writer.time += (MPI_Wtime() - begin) * 1e3;
     } else {
-        status = MPI_Send(&chunk->slice[1][0], chunk->nrows * chunk->ncols,
-                          MPI_C_BOOL, 0, PRINT, MPI_COMM_WORLD); // Start from 2nd row, [1][0], for nrows*ncols elements
-                                                                 // to skip both top and bottom ghost rows
-
-        if (status != MPI_SUCCESS) {
-            fprintf(stderr, "[*] Failed to send data to process 0 - errcode %d", status);
-            MPI_Abort(MPI_COMM_WORLD, 1);
-        }
+        send_block(chunk);
     }
 
     if (!big)
@@ -2,38 +2,323 @@
 #define GoL_CHUNK_INIT_H
 
 #include <mpi.h> // Enable MPI support
+#include <stdint.h>
 #include <stdio.h>
 #include <sys/types.h>
 
 // Custom includes
+#include "checkpoint.h"
 #include "chunk.h"
+#include "pattern.h"
+#include "shared.h"
+#include "../utils/board.h"
 #include "../utils/func.h"
+#include "../utils/frame.h"
+#include "../utils/pack.h"
+
+/**
+ * Arrange all MPI processes in a periodic 2D grid, and assign the calling process its block of GoL's board and its neighbours.
+ *
+ * The grid's dimensions are those given on the command line, if any, and MPI_Dims_create() fills in the missing ones. Processes
+ * keep their ranks in the grid, so that rank 0 is still the one that displays the board.
+ */
+void init_chunk_grid(chunk_t *chunk, life_t life) {
+    int di, dj, pr;
+
+    chunk->tot_rows = life.nrows;
+    chunk->tot_cols = life.ncols;
+
+    chunk->dims[0] = life.proc_rows;
+    chunk->dims[1] = life.proc_cols;
+
+    chunk->ghost = life.halo_depth;
+
+    // Deep halos are exchanged along the rows only, thus they take a grid of a single column
+    if (chunk->ghost != 1) {
+        if (chunk->dims[1] == 0) {
+            chunk->dims[1] = 1;
+        } else if (chunk->dims[1] > 1) {
+            if (chunk->rank == 0)
+                fprintf(stderr, "[*] Deep halos take a grid of a single column, falling back to a single ghost row...\n");
+
+            chunk->ghost = 1;
+        }
+    }
+
+    chunk->rebalance = life.rebalance;
+    chunk->exchange  = life.exchange;
+    chunk->wire      = life.wire;
+
+    chunk->checkpoint = life.checkpoint;
+    chunk->ckpt_data  = NULL;
+
+    chunk->dump = life.dump;
+
+    init_writer(&chunk->writer);
+
+    chunk->out_file = MPI_FILE_NULL;
+    chunk->out_end  = 0;
+
+    // Shared memory only holds the ghost rows, thus it takes a grid of a single column too
+    if (chunk->exchange == EXCHANGE_SHARED) {
+        if (chunk->dims[1] == 0) {
+            chunk->dims[1] = 1;
+        } else if (chunk->dims[1] > 1) {
+            if (chunk->rank == 0)
+                fprintf(stderr, "[*] Shared memory exchanges take a grid of a single column, falling back to messages...\n");
+
+            chunk->exchange = EXCHANGE_MESSAGE;
+        }
+    }
+
+    // Rows move within columns of processes, thus the blocks of a band would no longer match unless the grid has a single column
+    if (chunk->rebalance > 0) {
+        if (chunk->dims[1] == 0) {
+            chunk->dims[1] = 1;
+        } else if (chunk->dims[1] > 1) {
+            if (chunk->rank == 0)
+                fprintf(stderr, "[*] Rebalancing takes a grid of a single column, falling back to fixed rows...\n");
+
+            chunk->rebalance = 0;
+        }
+    }
+
+    // 1. Fill in the missing dimensions, if the given ones split the processes
+    if (chunk->size % ((chunk->dims[0] > 0 ? chunk->dims[0] : 1)
+            * (chunk->dims[1] > 0 ? chunk->dims[1] : 1)) != 0) {
+        if (chunk->rank == 0)
+            fprintf(stderr, "[*] A %dx%d grid of processes does not fit %d MPI processes!\n",
+                    chunk->dims[0], chunk->dims[1], chunk->size);
+        MPI_Abort(MPI_COMM_WORLD, 1);
+    }
+
+    MPI_Dims_create(chunk->size, 2, chunk->dims);
+
+    if (chunk->dims[0] > chunk->tot_rows
+            || chunk->dims[1] > chunk->tot_cols) {
+        if (chunk->rank == 0)
+            fprintf(stderr, "[*] A %dx%d grid of processes does not fit a %dx%d board!\n",
+                    chunk->dims[0], chunk->dims[1], chunk->tot_rows, chunk->tot_cols);
+        MPI_Abort(MPI_COMM_WORLD, 1);
+    }
+
+    // 2. Create the periodic grid, without reordering ranks
+    int periods[2] = {1, 1};
+
+    MPI_Cart_create(MPI_COMM_WORLD, 2, chunk->dims, periods, 0, &chunk->comm);
+    MPI_Cart_coords(chunk->comm, chunk->rank, 2, chunk->coords);
+
+    // 3. Identify the 8 neighbours, wrapping around the grid's borders
+    for (di = -1; di <= 1; di++)
+        for (dj = -1; dj <= 1; dj++) {
+            int coords[2] = {
+                (chunk->coords[0] + di + chunk->dims[0]) % chunk->dims[0],
+                (chunk->coords[1] + dj + chunk->dims[1]) % chunk->dims[1]
+            };
+
+            MPI_Cart_rank(chunk->comm, coords, &chunk->neighbs[di + 1][dj + 1]);
+        }
+
+    // 4. Identify the bands of processes, and the block of the calling process
+    chunk->row_starts = (int *) malloc(sizeof(int) * (chunk->dims[0] + 1));
+
+    if (chunk->row_starts == NULL) {
+        perror("[*] Failed to allocate the bands of processes.");
+        MPI_Abort(MPI_COMM_WORLD, 1);
+    }
+
+    for (pr = 0; pr <= chunk->dims[0]; pr++)
+        chunk->row_starts[pr] = chunk_start(chunk->tot_rows, chunk->dims[0], pr);
+
+    chunk->row0  = chunk->row_starts[chunk->coords[0]];
+    chunk->col0  = chunk_start(chunk->tot_cols, chunk->dims[1], chunk->coords[1]);
+    chunk->nrows = chunk->row_starts[chunk->coords[0] + 1] - chunk->row0;
+    chunk->ncols = chunk_start(chunk->tot_cols, chunk->dims[1], chunk->coords[1] + 1) - chunk->col0;
+
+    // 5. Ghost rows come from a single neighbour each, thus the halo is no deeper than the slimmest block
+    int min_rows = chunk_start(chunk->tot_rows, chunk->dims[0], 1);
+
+    if (chunk->ghost > min_rows)
+        chunk->ghost = min_rows;
+
+    // 6. Identify the neighbours on the same node, if they share memory
+    if (chunk->exchange == EXCHANGE_SHARED)
+        init_chunk_node(chunk);
+}
 
 /**
  * Allocate memory for the current and next slice of GoL data.
+ *
+ * Either slice is a single aligned slab, which greatly favours its exchange with MPI routines, with ghost rows on top and
+ * at the bottom, and ghost columns on either side of every row, as many as the depth of the halo. With EXCHANGE_SHARED, both slabs
+ * lie in the calling process' segment of a shared memory window, and all processes on the node have to call it at once. With
+ * WIRE_PACKED, the buffers of the ghost rows on the wire are allocated too.
  */
 void malloc_chunk(chunk_t *chunk) {
+    if (chunk->exchange == EXCHANGE_SHARED) {
+        malloc_shared_chunk(chunk);
+    } else {
+        chunk->slice      = malloc_frame(chunk->nrows, chunk->ncols, chunk->ghost);
+        chunk->next_slice = malloc_frame(chunk->nrows, chunk->ncols, chunk->ghost);
+    }
+
+    // Both slices share the same stride between rows
+    int stride = chunk->slice[1] - chunk->slice[0];
+
+    MPI_Type_vector(chunk->nrows, 1, stride, MPI_C_BOOL, &chunk->col_type);
+    MPI_Type_commit(&chunk->col_type);
+
+    MPI_Type_vector(chunk->ghost, chunk->ncols, stride, MPI_C_BOOL, &chunk->halo_type);
+    MPI_Type_commit(&chunk->halo_type);
+
+    if (chunk->wire == WIRE_PACKED) {
+        int side;
+
+        size_t nwords = wire_words(chunk->ghost, chunk->ncols);
+
+        for (side = 0; side < 2; side++) {
+            chunk->wire_send[side] = (uint64_t *) malloc(sizeof(uint64_t) * nwords);
+            chunk->wire_recv[side] = (uint64_t *) malloc(sizeof(uint64_t) * nwords);
+
+            if (chunk->wire_send[side] == NULL || chunk->wire_recv[side] == NULL) {
+                perror("[*] Failed to allocate the ghost rows on the wire.");
+                MPI_Abort(MPI_COMM_WORLD, 1);
+            }
+        }
+    }
+}
+
+/**
+ * Free the slices of GoL data, their datatypes and their buffers on the wire, if any.
+ */
+void free_chunk(chunk_t *chunk) {
+    if (chunk->exchange == EXCHANGE_SHARED) {
+        free_shared_chunk(chunk);
+    } else {
+        free_frame(chunk->slice, chunk->ghost);
+        free_frame(chunk->next_slice, chunk->ghost);
+    }
+
+    MPI_Type_free(&chunk->col_type);
+    MPI_Type_free(&chunk->halo_type);
+
+    if (chunk->wire == WIRE_PACKED) {
+        int side;
+
+        for (side = 0; side < 2; side++) {
+            free(chunk->wire_send[side]);
+            free(chunk->wire_recv[side]);
+        }
+    }
+}
+
+/**
+ * Change the depth of the halo of a chunk, once it has been initialized, by moving its slice to a frame of the new depth.
+ */
+void set_chunk_ghost(chunk_t *chunk, int ghost) {
     int i;
 
-    int ncols = chunk->ncols;
-    int nrows = chunk->nrows;
+    if (ghost == chunk->ghost)
+        return;
 
-    chunk->slice      = (bool **) malloc(sizeof(bool *) * (nrows + 2)); // + 2 to account for ghost rows
-    chunk->next_slice = (bool **) malloc(sizeof(bool *) * (nrows + 2));
+    chunk_t old = *chunk;
 
-    // Dinamically allocate the actual slices of GoL data as 1D arrays to guarantee their continuity in memory,
-    // which greatly favours their exchange with MPI routines...
-    bool *data      = (bool *) malloc((nrows + 2)*ncols * sizeof(bool));
-    bool *next_data = (bool *) malloc((nrows + 2)*ncols * sizeof(bool));
+    chunk->ghost = ghost;
+    malloc_chunk(chunk);
 
-    #ifdef _OPENMP
-    #pragma omp parallel for
-    #endif
-    // ...but let them be accessed as 2D matrices for ease of use
-    for (i = 0; i < nrows + 2; i++) {
-        chunk->slice[i]      = &(data[ncols*i]);
-        chunk->next_slice[i] = &(next_data[ncols*i]);
+    for (i = 0; i < chunk->nrows; i++)
+        memcpy(chunk->slice[i + ghost], old.slice[i + old.ghost], chunk->ncols);
+
+    free_chunk(&old);
+}
+
+/**
+ * Move the rows of the chunks from one process to another, once they have been initialized, so that the band of processes at pr
+ * owns the rows from row_starts[pr] to row_starts[pr + 1], on a grid of a single column. Every process sends the rows it owned to
+ * the processes that own them now, usually its neighbours, and receives its new rows into a frame of the new size.
+ * 
+ * @param row_starts    The new # of the top row of every band of processes, and tot_rows.
+ */
+void move_chunk_rows(chunk_t *chunk, int *row_starts) {
+    int pr, n = 0;
+
+    int nbands = chunk->dims[0];
+    int ghost  = chunk->ghost;
+
+    chunk_t old = *chunk;
+
+    chunk->row0  = row_starts[chunk->coords[0]];
+    chunk->nrows = row_starts[chunk->coords[0] + 1] - chunk->row0;
+
+    malloc_chunk(chunk);
+
+    MPI_Request *requests = (MPI_Request *) malloc(sizeof(MPI_Request) * 2 * nbands);
+    MPI_Datatype *types   = (MPI_Datatype *) malloc(sizeof(MPI_Datatype) * 2 * nbands);
+
+    if (requests == NULL || types == NULL) {
+        perror("[*] Failed to allocate the requests of the moving rows.");
+        MPI_Abort(MPI_COMM_WORLD, 1);
+    }
+
+    for (pr = 0; pr < nbands; pr++) {
+        int coords[2] = {pr, 0};
+        int r;
+
+        MPI_Cart_rank(chunk->comm, coords, &r);
+
+        // Rows the calling process owned, and the process at pr owns now...
+        int send_from = old.row0 > row_starts[pr] ? old.row0 : row_starts[pr];
+        int send_to   = old.row0 + old.nrows < row_starts[pr + 1] ? old.row0 + old.nrows : row_starts[pr + 1];
+
+        // ...and rows the process at pr owned, and the calling process owns now
+        int recv_from = old.row_starts[pr] > chunk->row0 ? old.row_starts[pr] : chunk->row0;
+        int recv_to   = old.row_starts[pr + 1] < chunk->row0 + chunk->nrows \
+                ? old.row_starts[pr + 1] : chunk->row0 + chunk->nrows;
+
+        if (r == chunk->rank) {
+            int i;
+
+            for (i = send_from; i < send_to; i++)
+                memcpy(chunk->slice[i - chunk->row0 + ghost], old.slice[i - old.row0 + ghost], chunk->ncols);
+
+            continue;
+        }
+
+        if (send_from < send_to) {
+            MPI_Type_vector(send_to - send_from, chunk->ncols, old.slice[1] - old.slice[0],
+                            MPI_C_BOOL, &types[n]);
+            MPI_Type_commit(&types[n]);
+
+            MPI_Isend(old.slice[send_from - old.row0 + ghost], 1, types[n],
+                      r, REBALANCE, chunk->comm, &requests[n]);
+            n++;
+        }
+
+        if (recv_from < recv_to) {
+            MPI_Type_vector(recv_to - recv_from, chunk->ncols, chunk->slice[1] - chunk->slice[0],
+                            MPI_C_BOOL, &types[n]);
+            MPI_Type_commit(&types[n]);
+
+            MPI_Irecv(chunk->slice[recv_from - chunk->row0 + ghost], 1, types[n],
+                      r, REBALANCE, chunk->comm, &requests[n]);
+            n++;
+        }
     }
+
+    MPI_Waitall(n, requests, MPI_STATUSES_IGNORE);
+
+    while (n > 0)
+        MPI_Type_free(&types[--n]);
+
+    free(requests);
+    free(types);
+
+    free_chunk(&old);
+
+    memcpy(chunk->row_starts, row_starts, sizeof(int) * (nbands + 1));
+
+    if (chunk->exchange == EXCHANGE_SHARED)
+        publish_shared_chunk(chunk);
 }
 
 /**
@@ -45,8 +330,8 @@ void init_empty_chunk(chunk_t *chunk) {
     #ifdef _OPENMP
     #pragma omp parallel for private(j)
     #endif
-    for (i = 0; i < chunk->nrows + 2; i++)
-        for (j = 0; j < chunk->ncols; j++) {
+    for (i = 0; i < chunk->nrows + 2*chunk->ghost; i++)
+        for (j = -chunk->ghost; j < chunk->ncols + chunk->ghost; j++) {
             chunk->slice[i][j]      = DEAD;
             chunk->next_slice[i][j] = DEAD;
         }
@@ -55,136 +340,186 @@ void init_empty_chunk(chunk_t *chunk) {
 /**
  * Initialize the slices of GoL data with ALIVE values randomly.
  * 
- * Each process will generate the very same sequence as a single process would do in the sequential case, but it will consider only
- * those values that belong to it, whose boundaries are passed in the arguments, plus its initial ghost rows.
- * 
- * @param from    The # of the top row belonging to the calling process
- * 
- * @param to      The # of the bottom row belonging to the calling process
+ * Each process only generates the values of its own block, via rand_cell(), which are the very same a single process would generate
+ * for those cells in the sequential case. Ghost cells are left DEAD, as they are exchanged before every generation.
  */
-void init_random_chunk(chunk_t *chunk, life_t life, int from, int to) {
-    int i, j, m, n;
-
-    bool top_g_row = false; // Check whether the top ghost row of the calling process has been visited.
-                            //
-                            // It strengthens the exit condition especially in the case of the rank 0 process,
-                            // whose top ghost row is actually the very last row in the whole GoL board.
-
-    // 1. Generate nrows*ncols random values as in the sequential case
-    for (i = 0; i < life.nrows; i++) {
-        for (j = 0; j < life.ncols; j++) { 
-            float f = rand_double(0., 1.);    
-
-            if (f < life.init_prob) {
-                m = (from - 1 + life.nrows) % life.nrows; // # of the top ghost row
-                n = (to + 1) % life.nrows;                // # of the botton ghost row
-
-                // 2. Assign values only if they belong to the process
-                // or to either its top/bottom ghost rows
-                if (i >= from  && i <= to) {
-                    chunk->slice[i - from + 1][j] = ALIVE;
-                } else if (i == m) {
-                    chunk->slice[0][j] = ALIVE;
-                    top_g_row = true;
-                } else if (i == n) {
-                    chunk->slice[chunk->nrows + 1][j] = ALIVE;
-                }
-            }
-        }
+void init_random_chunk(chunk_t *chunk, life_t life) {
+    int i, j;
 
-        // If the process has already collected all its values interrupt the loop,
-        // as there's no need to make it generate any more
-        if (i > to && top_g_row)
-            break;
+    #ifdef _OPENMP
+    #pragma omp parallel for private(j)
+    #endif
+    for (i = 0; i < chunk->nrows; i++) {
+        bool *row = chunk->slice[i + chunk->ghost];
+
+        for (j = 0; j < chunk->ncols; j++) { 
+            if (rand_cell(life.seed, chunk->row0 + i, chunk->col0 + j) < life.init_prob)
+                row[j] = ALIVE;
+        }
     } 
 }
 
 /**
  * Initialize the slices of GoL data with ALIVE values from file.
  * 
- * Each process will read the whole file as a single process would do in the sequential case, but it will consider only
- * those values that belong to it, whose boundaries are passed in the arguments, plus its initial ghost rows.
- * 
- * @param tot_rows    The overall number of rows in GoL's board.
+ * As every row of the board takes tot_cols characters and a newline, each process computes the offset of its own block within the
+ * file, and reads only its block with collective MPI-IO, via set_chunk_view(), rather than the whole file up to its bottom row.
  * 
- * @param tot_cols    The overall number of columns in GoL's board.
+ * @param infile      The name of the input file.
  * 
  * @param file_ptr    The pointer to the open input file starting from the 2nd line.
- * 
- * @param from        The # of the top row belonging to the calling process
- * 
- * @param to          The # of the bottom row belonging to the calling process
  */
-void init_chunk_from_file(chunk_t *chunk, int tot_rows, int tot_cols,
-        FILE *file_ptr, int from, int to) {
-    int i, m, n, l, r;
+void init_chunk_from_file(chunk_t *chunk, char *infile,
+        FILE *file_ptr) {
+    int i, l;
+    int status; // All MPI routines in C return an int error value
 
-    bool top_g_row = false;
+    int nrows = chunk->nrows;
+    int ncols = chunk->ncols;
+
+    // 1. Find where the board starts, right past the line of its dimensions, as fscanf() may have skipped leading whitespaces
+    rewind(file_ptr);
 
-    char *line = NULL;
-    size_t buf_size = 0; // Size of the buffer allocated to read the line
-    ssize_t len = 0;     // Amount of characters in the read line
+    if (fscanf(file_ptr, "%*[^\n]") == EOF || fgetc(file_ptr) != '\n') {
+        perror("[*] GoL's input file does not respect the number of rows!\n");
+        MPI_Abort(MPI_COMM_WORLD, 1);
+    }
 
-    bool finished = false; // Check whether all the necessary rows have been read correctly from the file,
-                           // and the loop hasn't finished for whatever other reason
+    MPI_Offset start = ftell(file_ptr);
+    MPI_Offset size;
 
-    i = 0;
+    fclose(file_ptr);
 
-    m = (from - 1 + tot_rows) % tot_rows; // # of the top ghost row
-    n = (to + 1) % tot_rows;              // # of the botton ghost row
+    MPI_File file;
 
-    // 1. Read all lines from the file
-    while ((len = getline(&line, &buf_size, file_ptr)) != -1) {
-        if (i >= tot_rows) {
-            perror("[*] GoL's input file exceeds the number of rows!\n");
-            MPI_Abort(MPI_COMM_WORLD, 1); 
-        }
+    status = MPI_File_open(chunk->comm, infile, MPI_MODE_RDONLY,
+                           MPI_INFO_NULL, &file);
 
-        if (len != tot_cols + 1) { // +1 for newline char, '\n'
-            fprintf(stderr, "[*] Row %d does not respect the number of columns!\n", i);
-            MPI_Abort(MPI_COMM_WORLD, 1); 
-        }
+    if (status != MPI_SUCCESS) {
+        fprintf(stderr, "[*] Failed to open the input file - errcode %d", status);
+        MPI_Abort(MPI_COMM_WORLD, 1);
+    }
 
-        // 2. Check if the values belong to the process
-        // or to either its top/bottom ghost rows
-        if (i >= from  && i <= to) {
-            r = i - from + 1;
-        } else if( i == m ) {
-            r = 0;
-            top_g_row = true;
-        } else if( i == n ) {
-            r = chunk->nrows + 1;
-        } else {
-            i++;
-            continue;
+    MPI_File_get_size(file, &size);
+
+    if (size != start + (MPI_Offset) chunk->tot_rows * (chunk->tot_cols + 1)) { // +1 for newline char, '\n'
+        perror("[*] GoL's input file does not respect the number of rows!\n");
+        MPI_Abort(MPI_COMM_WORLD, 1);
+    }
+
+    // 2. Read the block, together with all other processes
+    int width = set_chunk_view(chunk, file, start);
+
+    char *block = (char *) malloc((size_t) nrows * width);
+
+    if (block == NULL) {
+        perror("[*] Failed to allocate the input block.");
+        MPI_Abort(MPI_COMM_WORLD, 1);
+    }
+
+    status = MPI_File_read_at_all(file, 0, block, nrows * width, MPI_CHAR, MPI_STATUS_IGNORE);
+
+    if (status != MPI_SUCCESS) {
+        fprintf(stderr, "[*] Failed to read from the input file - errcode %d", status);
+        MPI_Abort(MPI_COMM_WORLD, 1);
+    }
+
+    MPI_File_close(&file);
+
+    // 3. Assign the values of the block
+    for (i = 0; i < nrows; i++) {
+        bool *row  = chunk->slice[i + chunk->ghost];
+        char *line = block + (size_t) i * width;
+
+        // Rightmost blocks also hold the newline, which tells apart rows of the wrong length
+        if (width > ncols && line[ncols] != '\n') {
+            fprintf(stderr, "[*] Row %d does not respect the number of columns!\n", chunk->row0 + i);
+            MPI_Abort(MPI_COMM_WORLD, 1);
         }
 
-        // 3. Assign all row values
-        for (l = 0; l < len - 1; l++){
+        for (l = 0; l < ncols; l++) {
             if (line[l] == 'X')
-                chunk->slice[r][l] = ALIVE;
+                row[l] = ALIVE;
         }
+    }
 
-        i++;
+    free(block);
+}
 
-        // As soon as the process has collected all its values interrupt the loop,
-        // since there's no need to make it read any more lines
-        if (i > to && top_g_row) {
-            finished = true;
-            break;
-        }
+/**
+ * Initialize the slices of GoL data with ALIVE values from a binary board, i.e., the checkpoint to restart from or the input file,
+ * whose header has already been read by set_grid_dimens_from_board(). Each process reads only the words that hold its own block,
+ * with collective MPI-IO.
+ */
+void init_chunk_from_board(chunk_t *chunk, char *board) {
+    int i;
+    int status; // All MPI routines in C return an int error value
+
+    int nrows = chunk->nrows;
+    int ncols = chunk->ncols;
+
+    size_t row_words = board_row_words(chunk->tot_cols);
+
+    // Words that hold the columns of the block
+    int w0     = chunk->col0 / 64;
+    int nwords = (chunk->col0 + ncols - 1) / 64 + 1 - w0;
+
+    MPI_File file;
+    MPI_Offset size;
+
+    status = MPI_File_open(chunk->comm, board, MPI_MODE_RDONLY,
+                           MPI_INFO_NULL, &file);
+
+    if (status != MPI_SUCCESS) {
+        fprintf(stderr, "[*] Failed to open the binary GoL board - errcode %d", status);
+        MPI_Abort(MPI_COMM_WORLD, 1);
     }
 
-    free(line);
-    line = NULL;
+    MPI_File_get_size(file, &size);
 
-    if (!finished) {
-        perror("[*] GoL's input file does not respect the number of rows!\n");
-        MPI_Abort(MPI_COMM_WORLD, 1); 
+    if (size < (MPI_Offset) (sizeof(board_header_t) + chunk->tot_rows * row_words * sizeof(uint64_t))) {
+        fprintf(stderr, "[*] The binary GoL board does not respect the number of rows!\n");
+        MPI_Abort(MPI_COMM_WORLD, 1);
     }
 
-    fflush(file_ptr);
-    fclose(file_ptr);
+    // 1. Read the words of the block, together with all other processes
+    int sizes[2]    = {chunk->tot_rows, (int) row_words};
+    int subsizes[2] = {nrows, nwords};
+    int starts[2]   = {chunk->row0, w0};
+
+    MPI_Datatype block_type;
+
+    MPI_Type_create_subarray(2, sizes, subsizes, starts,
+                             MPI_ORDER_C, MPI_UINT64_T, &block_type);
+    MPI_Type_commit(&block_type);
+
+    MPI_File_set_view(file, sizeof(board_header_t), MPI_UINT64_T, block_type,
+                      "native", MPI_INFO_NULL);
+
+    MPI_Type_free(&block_type);
+
+    uint64_t *words = (uint64_t *) malloc(sizeof(uint64_t) * nrows * nwords);
+
+    if (words == NULL) {
+        perror("[*] Failed to allocate the input block.");
+        MPI_Abort(MPI_COMM_WORLD, 1);
+    }
+
+    status = MPI_File_read_all(file, words, nrows * nwords, MPI_UINT64_T, MPI_STATUS_IGNORE);
+
+    if (status != MPI_SUCCESS) {
+        fprintf(stderr, "[*] Failed to read from the binary GoL board - errcode %d", status);
+        MPI_Abort(MPI_COMM_WORLD, 1);
+    }
+
+    MPI_File_close(&file);
+
+    // 2. Unpack the columns of the block
+    for (i = 0; i < nrows; i++)
+        unpack_row_at(words + (size_t) nwords * i, chunk->col0 - 64 * w0, ncols,
+                      chunk->slice[i + chunk->ghost]);
+
+    free(words);
 }
 
 #endif
@@ -0,0 +1,68 @@
+#ifndef GoL_CHUNK_PATTERN_H
+#define GoL_CHUNK_PATTERN_H
+
+#include <mpi.h> // Enable MPI support
+#include <stdio.h>
+#include <stdlib.h>
+
+// Custom includes
+#include "chunk.h"
+#include "../utils/pattern.h"
+
+/**
+ * Initialize the slices of GoL data with ALIVE values from the input pattern, placed at its offset. Every process reads the whole
+ * pattern, which is small, and only keeps the cells that fall within its own block.
+ */
+void init_chunk_from_pattern(chunk_t *chunk, life_t life) {
+    pattern_window_t window;
+
+    window.rows     = chunk->slice + chunk->ghost;
+    window.row0     = chunk->row0;
+    window.col0     = chunk->col0;
+    window.nrows    = chunk->nrows;
+    window.ncols    = chunk->ncols;
+    window.tot_rows = chunk->tot_rows;
+    window.tot_cols = chunk->tot_cols;
+    window.off_row  = life.pattern_row;
+    window.off_col  = life.pattern_col;
+
+    if (!read_pattern(life.infile, life.pattern, &window))
+        MPI_Abort(MPI_COMM_WORLD, 1);
+}
+
+/**
+ * Export the current GoL board to the export file, as a pattern. Rank 0 gathers the board one band of processes at a time, via
+ * gather_band(), and writes it one row at a time.
+ */
+void export_chunk_pattern(chunk_t *chunk, char *exportfile) {
+    if (chunk->rank == 0) {
+        int pr, i;
+
+        pattern_writer_t writer;
+
+        if (!open_pattern(&writer, exportfile, chunk->tot_rows, chunk->tot_cols))
+            MPI_Abort(MPI_COMM_WORLD, 1);
+
+        uint64_t *wire;
+        int max_words;
+
+        bool *band = malloc_band(chunk, &wire, &max_words);
+
+        for (pr = 0; pr < chunk->dims[0]; pr++) {
+            gather_band(chunk, pr, band, wire, max_words);
+
+            for (i = 0; i < chunk->row_starts[pr + 1] - chunk->row_starts[pr]; i++)
+                write_pattern_row(&writer, band + (size_t) i * chunk->tot_cols, chunk->tot_cols);
+        }
+
+        free(band);
+        free(wire);
+
+        if (!close_pattern(&writer))
+            MPI_Abort(MPI_COMM_WORLD, 1);
+    } else {
+        send_block(chunk);
+    }
+}
+
+#endif
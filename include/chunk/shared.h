@@ -0,0 +1,241 @@
+#ifndef GoL_CHUNK_SHARED_H
+#define GoL_CHUNK_SHARED_H
+
+#include <mpi.h> // Enable MPI support
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Custom includes
+#include "chunk.h"
+#include "../utils/frame.h"
+
+/*
+ * With EXCHANGE_SHARED, the slices of all processes on a node live in a single shared memory window, one segment per process, so that
+ * a process copies the borders of its neighbours on the same node straight into its ghost rows, rather than through MPI messages.
+ * Each segment starts with the counters of enum SharedFlags, which order the copies as the flags of the persistent thread team do:
+ *
+ * - at its b-th block of generations, a process copies its neighbours' borders once they have completed b - 1 blocks;
+ * - then, it overwrites its next slice, which holds its state after b - 2 blocks, once its neighbours have copied it at their own
+ *   (b - 1)-th block;
+ * - with deep halos, the 2nd generation of the block overwrites the state after b - 1 blocks, thus it waits until its neighbours
+ *   have copied it at their own b-th block.
+ *
+ * As all processes swap their slices as many times per block, their states after b - 1 blocks lie in the same slice of each segment.
+ */
+
+/**
+ * Identify the processes on the same node as the calling one, and whether its top and bottom neighbours are among them.
+ */
+void init_chunk_node(chunk_t *chunk) {
+    MPI_Group group, node_group;
+
+    int ranks[2] = {chunk->neighbs[0][1], chunk->neighbs[2][1]};
+
+    MPI_Comm_split_type(chunk->comm, MPI_COMM_TYPE_SHARED, chunk->rank,
+                        MPI_INFO_NULL, &chunk->node_comm);
+
+    MPI_Comm_group(chunk->comm, &group);
+    MPI_Comm_group(chunk->node_comm, &node_group);
+
+    MPI_Group_translate_ranks(group, 2, ranks, node_group, chunk->node_neighbs);
+
+    MPI_Group_free(&group);
+    MPI_Group_free(&node_group);
+
+    chunk->blocks = 0;
+}
+
+/**
+ * Set one of the counters of the calling process, once all its previous writes to its segment are visible to the other processes.
+ */
+void set_shared_flag(chunk_t *chunk, int flag, int value) {
+    int node_rank;
+
+    MPI_Comm_rank(chunk->node_comm, &node_rank);
+
+    MPI_Win_sync(chunk->window);
+
+    MPI_Accumulate(&value, 1, MPI_INT, node_rank, flag * sizeof(int), 1, MPI_INT,
+                   MPI_REPLACE, chunk->window);
+    MPI_Win_flush(node_rank, chunk->window);
+}
+
+/**
+ * Wait until one of the counters of a process on the same node has reached the given value.
+ *
+ * @return wait_time    The time spent waiting, in ms.
+ */
+double wait_shared_flag(chunk_t *chunk, int node_rank, int flag, int value) {
+    int spins = 0;
+    int done;
+
+    double start = MPI_Wtime();
+
+    for (;;) {
+        MPI_Fetch_and_op(NULL, &done, MPI_INT, node_rank, flag * sizeof(int),
+                         MPI_NO_OP, chunk->window);
+        MPI_Win_flush(node_rank, chunk->window);
+
+        if (done >= value)
+            break;
+
+        if (++spins == DEFAULT_SHARED_SPINS) {
+            spins = 0;
+            sched_yield();
+        }
+    }
+
+    // The writes that preceded the counter are visible from now on
+    MPI_Win_sync(chunk->window);
+
+    return (MPI_Wtime() - start) * 1000.;
+}
+
+/**
+ * Wait until one of the counters of both the top and bottom neighbours, if on the same node, has reached the given value.
+ *
+ * @return wait_time    The time spent waiting, in ms.
+ */
+double wait_shared_neighbs(chunk_t *chunk, int flag, int value) {
+    int side;
+
+    double wait_time = 0.;
+
+    for (side = 0; side < 2; side++)
+        if (chunk->node_neighbs[side] != MPI_UNDEFINED)
+            wait_time += wait_shared_flag(chunk, chunk->node_neighbs[side], flag, value);
+
+    return wait_time;
+}
+
+/**
+ * Allocate the current and next slice of GoL data in the calling process' segment of a new shared memory window, right after its
+ * counters. All processes on the node have to call it at once.
+ *
+ * The counters are only valid once set_shared_flag() has published them, thus the slices must be filled in before that.
+ */
+void malloc_shared_chunk(chunk_t *chunk) {
+    int f;
+
+    size_t size = frame_size(chunk->nrows, chunk->ncols, chunk->ghost);
+
+    char *base;
+
+    // Segments are apart from one another, thus page aligned, as most MPI implementations do
+    MPI_Info info;
+
+    MPI_Info_create(&info);
+    MPI_Info_set(info, "alloc_shared_noncontig", "true");
+
+    int status = MPI_Win_allocate_shared(DEFAULT_ALIGNMENT + 2*size, 1, info,
+                                         chunk->node_comm, &base, &chunk->window);
+
+    MPI_Info_free(&info);
+
+    if (status != MPI_SUCCESS) {
+        fprintf(stderr, "[*] Failed to allocate the shared memory window - errcode %d", status);
+        MPI_Abort(MPI_COMM_WORLD, 1);
+    }
+
+    chunk->slice      = frame_rows((bool *) (base + DEFAULT_ALIGNMENT), chunk->nrows, chunk->ncols, chunk->ghost);
+    chunk->next_slice = frame_rows((bool *) (base + DEFAULT_ALIGNMENT + size), chunk->nrows, chunk->ncols, chunk->ghost);
+
+    // No counter may be read before all processes have reset their own ones
+    MPI_Win_lock_all(MPI_MODE_NOCHECK, chunk->window);
+
+    for (f = 0; f < NUM_SHARED_FLAGS; f++)
+        set_shared_flag(chunk, f, -1);
+
+    MPI_Barrier(chunk->node_comm);
+}
+
+/**
+ * Free the slices of GoL data together with their shared memory window. All processes on the node have to call it at once.
+ */
+void free_shared_chunk(chunk_t *chunk) {
+    free(chunk->slice);
+    free(chunk->next_slice);
+
+    MPI_Win_unlock_all(chunk->window);
+    MPI_Win_free(&chunk->window);
+}
+
+/**
+ * Publish that the slices of the calling process hold its state after the blocks completed so far, e.g., once they have been filled
+ * in or moved to a new window.
+ */
+void publish_shared_chunk(chunk_t *chunk) {
+    set_shared_flag(chunk, SHARED_CONSUMED, chunk->blocks);
+    set_shared_flag(chunk, SHARED_READY, chunk->blocks);
+}
+
+/**
+ * Copy the borders of the neighbours on the same node into the ghost rows of the calling process, at the start of a block of
+ * generations, and wait until the next slice can be overwritten.
+ *
+ * @return wait_time    The time spent waiting for the neighbours, in ms.
+ */
+double exchange_shared_halo(chunk_t *chunk) {
+    int side, i;
+
+    int ncols = chunk->ncols;
+    int ghost = chunk->ghost;
+    int b     = chunk->blocks + 1; // # of the block about to start
+
+    int nbands = chunk->dims[0];
+
+    // Slice that holds the state after b - 1 blocks in every segment
+    bool current = chunk->slice[0] > chunk->next_slice[0];
+
+    double wait_time = 0.;
+
+    size_t stride = frame_stride(ncols, ghost);
+    size_t offset = frame_offset(ghost);
+
+    // 1. Copy the bottom border of the top neighbour and the top border of the bottom neighbour
+    for (side = 0; side < 2; side++) {
+        int node_rank = chunk->node_neighbs[side];
+
+        if (node_rank == MPI_UNDEFINED)
+            continue;
+
+        int pr    = (chunk->coords[0] + (side == 0 ? -1 : 1) + nbands) % nbands;
+        int nrows = chunk->row_starts[pr + 1] - chunk->row_starts[pr];
+
+        MPI_Aint size;
+        int disp_unit;
+        char *base;
+
+        MPI_Win_shared_query(chunk->window, node_rank, &size, &disp_unit, &base);
+
+        wait_time += wait_shared_flag(chunk, node_rank, SHARED_READY, b - 1);
+
+        // Either slice of the neighbour, with its rows laid out as those of the calling process but for their number
+        bool *data = (bool *) (base + DEFAULT_ALIGNMENT + current * frame_size(nrows, ncols, ghost)) + offset;
+
+        for (i = 0; i < ghost; i++) {
+            if (side == 0)
+                memcpy(chunk->slice[i], data + stride * (nrows + i), ncols);
+            else
+                memcpy(chunk->slice[ghost + chunk->nrows + i], data + stride * (ghost + i), ncols);
+        }
+    }
+
+    set_shared_flag(chunk, SHARED_CONSUMED, b);
+
+    // 2. Wait until the neighbours have copied the state about to be overwritten
+    return wait_time + wait_shared_neighbs(chunk, SHARED_CONSUMED, b - 1);
+}
+
+/**
+ * Publish that the calling process has completed a block of generations.
+ */
+void complete_shared_block(chunk_t *chunk) {
+    chunk->blocks++;
+
+    set_shared_flag(chunk, SHARED_READY, chunk->blocks);
+}
+
+#endif
@@ -0,0 +1,72 @@
+#ifndef GoL_CHUNK_WIRE_H
+#define GoL_CHUNK_WIRE_H
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Custom includes
+#include "../globals.h"
+#include "../utils/pack.h"
+
+/*
+ * With WIRE_PACKED, the rows sent by MPI processes are packed 64 cells per word, via pack_row(), and the rows with no ALIVE cells
+ * are not sent at all. A message of nrows rows starts with a mask of nrows bits, one per row, and goes on with the words of those
+ * rows whose bit is set, in order. Thus, a message of DEAD rows takes the mask alone.
+ */
+
+/**
+ * Evaluate the largest number of words a message of nrows rows of ncols cells can take, i.e., with no DEAD rows.
+ */
+size_t wire_words(int nrows, int ncols) {
+    return (size_t) (nrows + 63) / 64 + (size_t) nrows * ((ncols + 63) / 64);
+}
+
+/**
+ * Pack nrows rows of ncols cells, stride cells apart from one another, into a message.
+ *
+ * @return count    The number of words of the message.
+ */
+int pack_rows(const bool *rows, size_t stride, int nrows, int ncols, uint64_t *buffer) {
+    int i;
+
+    int nmask  = (nrows + 63) / 64;
+    int nwords = (ncols + 63) / 64;
+
+    uint64_t *words = buffer + nmask;
+
+    memset(buffer, 0, sizeof(uint64_t) * nmask);
+
+    for (i = 0; i < nrows; i++) {
+        // DEAD rows are overwritten by the next one
+        if (pack_row(rows + stride * i, ncols, words)) {
+            buffer[i / 64] |= (uint64_t) 1 << (i % 64);
+            words += nwords;
+        }
+    }
+
+    return (int) (words - buffer);
+}
+
+/**
+ * Unpack a message of nrows rows of ncols cells into rows stride cells apart from one another.
+ */
+void unpack_rows(const uint64_t *buffer, bool *rows, size_t stride, int nrows, int ncols) {
+    int i;
+
+    int nmask  = (nrows + 63) / 64;
+    int nwords = (ncols + 63) / 64;
+
+    const uint64_t *words = buffer + nmask;
+
+    for (i = 0; i < nrows; i++) {
+        if ((buffer[i / 64] >> (i % 64)) & 1) {
+            unpack_row(words, ncols, rows + stride * i);
+            words += nwords;
+        } else {
+            memset(rows + stride * i, DEAD, ncols);
+        }
+    }
+}
+
+#endif
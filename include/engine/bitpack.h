@@ -0,0 +1,222 @@
+#ifndef GoL_ENGINE_BITPACK_H
+#define GoL_ENGINE_BITPACK_H
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+// Custom includes
+#include "../globals.h"
+#include "../life/life.h"
+
+/**
+ * GoL's board packed 64 cells per word. Each row spans nwords words, where the j-th cell of a row is stored
+ * as the (j % 64)-th bit of its (j / 64)-th word. The bits beyond the last column are always kept DEAD.
+ */
+typedef struct bitpack {
+    int nwords;           // Number of words per row
+    int tail;             // Number of valid bits in the last word of each row := 1, ..., 64
+
+    uint64_t **grid;      // Packed game grid at the current step
+    uint64_t **next_grid; // Packed game grid at the next step
+} bitpack_t;
+
+/**
+ * Allocate memory for the current and next packed GoL board. Either board is a single 1D array accessed as a 2D matrix.
+ */
+bitpack_t* malloc_bitpack(int nrows, int ncols) {
+    int i;
+
+    bitpack_t *bp = (bitpack_t *) malloc(sizeof(bitpack_t));
+
+    if (bp == NULL) {
+        perror("[*] GoL's packed board allocation failed!\n");
+        exit(EXIT_FAILURE);
+    }
+
+    bp->nwords = (ncols + 63) / 64;
+    bp->tail   = ncols - 64 * (bp->nwords - 1);
+
+    bp->grid      = (uint64_t **) malloc(sizeof(uint64_t *) * nrows);
+    bp->next_grid = (uint64_t **) malloc(sizeof(uint64_t *) * nrows);
+
+    uint64_t *data      = (uint64_t *) calloc((size_t) nrows * bp->nwords, sizeof(uint64_t));
+    uint64_t *next_data = (uint64_t *) calloc((size_t) nrows * bp->nwords, sizeof(uint64_t));
+
+    if (bp->grid == NULL || bp->next_grid == NULL
+            || data == NULL || next_data == NULL) {
+        perror("[*] GoL's packed board allocation failed!\n");
+        exit(EXIT_FAILURE);
+    }
+
+    for (i = 0; i < nrows; i++) {
+        bp->grid[i]      = &(data[(size_t) bp->nwords * i]);
+        bp->next_grid[i] = &(next_data[(size_t) bp->nwords * i]);
+    }
+
+    return bp;
+}
+
+/**
+ * Pack GoL's board 64 cells per word.
+ */
+void pack_grid(life_t *life) {
+    int i, j;
+
+    bitpack_t *bp = (bitpack_t *) life->engine_state;
+
+    #ifdef _OPENMP
+    #pragma omp parallel for private(j)
+    #endif
+    for (i = 0; i < life->nrows; i++) {
+        for (j = 0; j < bp->nwords; j++)
+            bp->grid[i][j] = 0;
+
+        for (j = 0; j < life->ncols; j++)
+            if (life->grid[i][j] == ALIVE)
+                bp->grid[i][j / 64] |= (uint64_t) 1 << (j % 64);
+    }
+}
+
+/**
+ * Unpack the packed board back into GoL's board, one bool per cell, so it can be displayed.
+ */
+void unpack_grid(life_t *life) {
+    int i, j;
+
+    bitpack_t *bp = (bitpack_t *) life->engine_state;
+
+    #ifdef _OPENMP
+    #pragma omp parallel for private(j)
+    #endif
+    for (i = 0; i < life->nrows; i++)
+        for (j = 0; j < life->ncols; j++)
+            life->grid[i][j] = (bp->grid[i][j / 64] >> (j % 64)) & 1 \
+                    ? ALIVE : DEAD;
+}
+
+/**
+ * Initialize the packed board from GoL's board, which must have already been initialized.
+ */
+void init_bitpack(life_t *life) {
+    life->engine_state = malloc_bitpack(life->nrows, life->ncols);
+
+    pack_grid(life);
+}
+
+/**
+ * Compute the words holding the west and east neighbours of all cells in the k-th word of a packed row,
+ * wrapping around the row's ends as the board is toroidal.
+ */
+static inline void bitpack_shift(const uint64_t *row, int k, int nwords, int tail,
+        uint64_t *west, uint64_t *east) {
+    bool last = (k == nwords - 1);
+
+    uint64_t cur = row[k];
+
+    // The west neighbour of the 1st cell in the word is the last cell of the previous word, or of the row
+    uint64_t carry_in = (k > 0) \
+            ? row[k - 1] >> 63 : (row[nwords - 1] >> (tail - 1)) & 1;
+
+    // The east neighbour of the last cell in the word is the 1st cell of the next word, or of the row
+    uint64_t carry_out = last \
+            ? row[0] & 1 : row[k + 1] & 1;
+
+    *west = (cur << 1) | carry_in;
+    *east = (cur >> 1) | (carry_out << (last ? tail - 1 : 63));
+}
+
+/**
+ * Perform one evolutionary step of the packed board, following GoL rules, on 64 cells at a time.
+ *
+ * For every cell, its 8 neighbours are summed in parallel across the whole word with carry-save adders:
+ *     1. The 3 cells above and the 3 cells below reduce to two 2-bit sums, whereas the west/east cells reduce to one;
+ *     2. Their low bits reduce to a further sum bit, `ones`, plus a carry, whose weight is 2;
+ *     3. The number of neighbours is 2 or 3 iff exactly one of the 4 bits of weight 2 is set, and it is 3 iff `ones` is also set.
+ *
+ * Hence a cell is ALIVE at the next step iff exactly one bit of weight 2 is set, and either `ones` is set or the cell is ALIVE.
+ */
+void evolve_bitpack(life_t *life) {
+    int i, k;
+
+    int nrows = life->nrows;
+
+    bitpack_t *bp = (bitpack_t *) life->engine_state;
+
+    int nwords = bp->nwords;
+    int tail   = bp->tail;
+
+    uint64_t tail_mask = (tail == 64) \
+            ? ~(uint64_t) 0 : ((uint64_t) 1 << tail) - 1;
+
+    #ifdef _OPENMP
+    #pragma omp parallel for private(k)
+    #endif
+    for (i = 0; i < nrows; i++) {
+        const uint64_t *up   = bp->grid[(i - 1 + nrows) % nrows];
+        const uint64_t *mid  = bp->grid[i];
+        const uint64_t *down = bp->grid[(i + 1) % nrows];
+
+        uint64_t *next = bp->next_grid[i];
+
+        for (k = 0; k < nwords; k++) {
+            uint64_t nw, n, ne, w, e, sw, s, se;
+
+            n = up[k];
+            s = down[k];
+
+            bitpack_shift(up,   k, nwords, tail, &nw, &ne);
+            bitpack_shift(mid,  k, nwords, tail, &w,  &e);
+            bitpack_shift(down, k, nwords, tail, &sw, &se);
+
+            // 1. Full adders on the rows above and below, half adder on the current row
+            uint64_t up_sum    = nw ^ n ^ ne;
+            uint64_t up_carry  = (nw & n) | (ne & (nw ^ n));
+
+            uint64_t down_sum   = sw ^ s ^ se;
+            uint64_t down_carry = (sw & s) | (se & (sw ^ s));
+
+            uint64_t mid_sum   = w ^ e;
+            uint64_t mid_carry = w & e;
+
+            // 2. Full adder on the low bits
+            uint64_t ones  = up_sum ^ down_sum ^ mid_sum;
+            uint64_t carry = (up_sum & down_sum) | (mid_sum & (up_sum ^ down_sum));
+
+            // 3. Exactly one of the 4 bits of weight 2 is set
+            uint64_t lo_sum   = up_carry ^ down_carry;
+            uint64_t lo_carry = up_carry & down_carry;
+            uint64_t hi_sum   = mid_carry ^ carry;
+            uint64_t hi_carry = mid_carry & carry;
+
+            uint64_t twos = (lo_sum ^ hi_sum) & ~(lo_carry | hi_carry);
+
+            next[k] = twos & (ones | mid[k]);
+        }
+
+        // Keep the bits beyond the last column DEAD
+        next[nwords - 1] &= tail_mask;
+    }
+
+    // Replace the old grid with the updated one
+    uint64_t **temp = bp->grid;
+
+    bp->grid      = bp->next_grid;
+    bp->next_grid = temp;
+}
+
+void cleanup_bitpack(life_t *life) {
+    bitpack_t *bp = (bitpack_t *) life->engine_state;
+
+    free(bp->grid[0]);
+    free(bp->next_grid[0]);
+
+    free(bp->grid);
+    free(bp->next_grid);
+
+    free(bp);
+
+    life->engine_state = NULL;
+}
+
+#endif
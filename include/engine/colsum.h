@@ -0,0 +1,145 @@
+#ifndef GoL_ENGINE_COLSUM_H
+#define GoL_ENGINE_COLSUM_H
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+// Custom includes
+#include "../globals.h"
+#include "../life/life.h"
+#include "../utils/frame.h"
+
+#ifdef GoL_MPI
+#include "../chunk/chunk.h"
+#endif
+
+// Vertical sums of every thread, one after the other and each sized for the widest row, so that no evolution allocates them
+unsigned char *COLSUM_SUMS = NULL;
+size_t COLSUM_STRIDE = 0;
+
+/**
+ * Allocate the vertical sums of every thread for rows of ncols cells, once before the evolution.
+ */
+void init_colsum(int ncols) {
+    int nthreads = 1;
+
+    #ifdef _OPENMP
+    nthreads = omp_get_max_threads();
+    #endif
+
+    // + 2 for the ghost columns
+    COLSUM_STRIDE = align_up(ncols + 2);
+
+    if (posix_memalign((void **) &COLSUM_SUMS, DEFAULT_ALIGNMENT, COLSUM_STRIDE * nthreads) != 0) {
+        perror("[*] Column sums allocation failed!\n");
+        exit(EXIT_FAILURE);
+    }
+}
+
+/**
+ * Free the vertical sums of every thread.
+ */
+void cleanup_colsum(void) {
+    free(COLSUM_SUMS);
+
+    COLSUM_SUMS = NULL;
+}
+
+/**
+ * Evolve the rows in [from, to) of a board whose ghost cells are up to date, one row after the other, with separable neighbour counting.
+ *
+ * The vertical sums of the 3 cells above, on and below the current row are kept for every column, ghost columns included. Moving down
+ * one row, they roll by adding the new row below and subtracting the old row above. The 3x3 sum of a cell is then three horizontal adds,
+ * minus the cell itself: that is, about three loads per cell rather than nine.
+ *
+ * @param sums    The vertical sums of the calling thread, ncols + 2 of them, shifted by one so that ghost columns lie at sums[0]
+ *                and sums[ncols + 1].
+ */
+void evolve_colsum_rows(bool **grid, bool **next_grid,
+        int from, int to, int ncols, unsigned char *sums) {
+    int i, j;
+
+    if (from >= to)
+        return;
+
+    unsigned char *v = sums + 1;
+
+    for (j = -1; j <= ncols; j++)
+        v[j] = grid[from - 1][j] + grid[from][j] + grid[from + 1][j];
+
+    for (i = from; i < to; i++) {
+        const bool *mid = grid[i];
+        bool *next = next_grid[i];
+
+        // 1. Roll the vertical sums down to the current row
+        if (i > from) {
+            const bool *gone = grid[i - 2];
+            const bool *come = grid[i + 1];
+
+            for (j = -1; j <= ncols; j++)
+                v[j] += come[j] - gone[j];
+        }
+
+        // 2. Sum them horizontally to get the neighbours of every cell
+        for (j = 0; j < ncols; j++) {
+            int alive_neighbs = v[j - 1] + v[j] + v[j + 1] - mid[j];
+
+            next[j] = (alive_neighbs == 3) | ((alive_neighbs == 2) & mid[j]);
+        }
+    }
+}
+
+/**
+ * Evolve the rows in [from, to) of a board whose ghost cells are up to date. With OpenMP, every thread rolls its column sums
+ * down its own contiguous block of rows.
+ */
+void evolve_colsum_block(bool **grid, bool **next_grid,
+        int from, int to, int ncols) {
+    #ifdef _OPENMP
+    #pragma omp parallel
+    {
+        int nthreads = omp_get_num_threads();
+        int tid      = omp_get_thread_num();
+
+        int nrows = to - from;
+
+        evolve_colsum_rows(grid, next_grid,
+                from + nrows * tid / nthreads,
+                from + nrows * (tid + 1) / nthreads, ncols,
+                COLSUM_SUMS + COLSUM_STRIDE * tid);
+    }
+    #else
+    evolve_colsum_rows(grid, next_grid, from, to, ncols, COLSUM_SUMS);
+    #endif
+}
+
+/**
+ * Perform one evolutionary step of the board with separable neighbour counting.
+ */
+void evolve_colsum(life_t *life) {
+    // 1. Refresh the ghost frame
+    wrap_frame(life->grid, life->nrows, life->ncols, 1);
+
+    // 2. Evolve every cell in the grid
+    evolve_colsum_block(life->grid, life->next_grid,
+            0, life->nrows, life->ncols);
+
+    // 3. Replace the old grid with the updated one
+    swap_grids(&life->grid, &life->next_grid);
+}
+
+#ifdef GoL_MPI
+/**
+ * Evolve the rows in [from, to) of a chunk with separable neighbour counting, once its ghost cells are up to date.
+ */
+void evolve_chunk_colsum(chunk_t *chunk, int from, int to) {
+    evolve_colsum_block(chunk->slice, chunk->next_slice,
+            from, to, chunk->ncols);
+}
+#endif
+
+#endif
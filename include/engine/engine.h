@@ -0,0 +1,239 @@
+#ifndef GoL_ENGINE_H
+#define GoL_ENGINE_H
+
+// Custom includes
+#include "../globals.h"
+#include "../life/life.h"
+
+#include "bitpack.h"
+#include "padded.h"
+#include "simd.h"
+#include "lut.h"
+#include "colsum.h"
+#include "tiled.h"
+#include "hashlife.h"
+#include "sparse.h"
+#include "temporal.h"
+#include "team.h"
+
+/**
+ * Initialize the data structures of the selected evolution engine, once GoL's board has been initialized.
+ */
+void engine_init(life_t *life) {
+    switch (life->engine) {
+        case ENGINE_BITPACK:
+            init_bitpack(life);
+            break;
+        case ENGINE_SIMD:
+            printf("Evolving GoL's grid with %s kernels\n\n", SIMD_NAMES[init_simd()]);
+            break;
+        case ENGINE_LUT:
+            init_lut();
+            break;
+        case ENGINE_COLSUM:
+            init_colsum(life->ncols);
+            break;
+        case ENGINE_TILED:
+            init_tiled(life);
+            break;
+        case ENGINE_HASHLIFE:
+            init_hashlife(life);
+            break;
+        case ENGINE_SPARSE:
+            init_sparse(life);
+            break;
+        case ENGINE_AUTO:
+            init_auto(life);
+            break;
+        case ENGINE_TEMPORAL:
+            init_temporal(life);
+            break;
+        default:
+            break;
+    }
+}
+
+/**
+ * Perform one or more evolutionary steps of the board with the selected evolution engine. All engines perform a single step
+ * at a time, but HashLife, which jumps ahead by the largest power of 2 not exceeding max_steps, and the temporal engine,
+ * which advances by a whole time block of at most max_steps generations. Small boards are evolved with max_steps = 1, as
+ * they are displayed at every generation.
+ *
+ * @return steps    The number of generations the board has been advanced by.
+ */
+int engine_evolve(life_t *life, int max_steps) {
+    switch (life->engine) {
+        case ENGINE_HASHLIFE:
+            return evolve_hashlife(life, max_steps);
+        case ENGINE_TEMPORAL:
+            return evolve_temporal(life, max_steps);
+        case ENGINE_BITPACK:
+            evolve_bitpack(life);
+            break;
+        case ENGINE_PADDED:
+            evolve_padded(life);
+            break;
+        case ENGINE_SIMD:
+            evolve_simd(life);
+            break;
+        case ENGINE_LUT:
+            evolve_lut(life);
+            break;
+        case ENGINE_COLSUM:
+            evolve_colsum(life);
+            break;
+        case ENGINE_TILED:
+            evolve_tiled(life);
+            break;
+        case ENGINE_SPARSE:
+            evolve_sparse(life);
+            break;
+        case ENGINE_AUTO:
+            evolve_auto(life);
+            break;
+        default:
+            evolve(life);
+    }
+
+    return 1;
+}
+
+/**
+ * Bring GoL's board, one bool per cell, up to date with the selected evolution engine's data, so it can be displayed.
+ */
+void engine_sync(life_t *life) {
+    switch (life->engine) {
+        case ENGINE_BITPACK:
+            unpack_grid(life);
+            break;
+        case ENGINE_SPARSE:
+            sync_sparse(life);
+            break;
+        case ENGINE_AUTO:
+            sync_auto(life);
+            break;
+        default:
+            break;
+    }
+}
+
+/**
+ * Print to console the statistics collected by the selected evolution engine, if any, once GoL's evolution is over.
+ */
+void engine_report(life_t life) {
+    switch (life.engine) {
+        case ENGINE_TILED:
+            report_tiled(life);
+            break;
+        case ENGINE_HASHLIFE:
+            report_hashlife(life);
+            break;
+        case ENGINE_AUTO:
+            report_auto(life);
+            break;
+        default:
+            break;
+    }
+}
+
+void engine_cleanup(life_t *life) {
+    switch (life->engine) {
+        case ENGINE_BITPACK:
+            cleanup_bitpack(life);
+            break;
+        case ENGINE_COLSUM:
+            cleanup_colsum();
+            break;
+        case ENGINE_TILED:
+            cleanup_tiled(life);
+            break;
+        case ENGINE_HASHLIFE:
+            cleanup_hashlife(life);
+            break;
+        case ENGINE_SPARSE:
+            cleanup_sparse(life);
+            break;
+        case ENGINE_AUTO:
+            cleanup_auto(life);
+            break;
+        case ENGINE_TEMPORAL:
+            cleanup_temporal(life);
+            break;
+        default:
+            break;
+    }
+}
+
+#ifdef GoL_MPI
+/**
+ * Evaluate whether the evolution engine can also evolve the chunks of MPI processes.
+ */
+bool engine_supports_chunk(int engine) {
+    return engine == ENGINE_NAIVE
+            || engine == ENGINE_PADDED
+            || engine == ENGINE_SIMD
+            || engine == ENGINE_LUT
+            || engine == ENGINE_COLSUM;
+}
+
+/**
+ * Initialize the data structures of a chunk's evolution engine.
+ */
+void engine_init_chunk(chunk_t *chunk) {
+    switch (chunk->engine) {
+        case ENGINE_SIMD: {
+            int level = init_simd();
+
+            if (chunk->rank == 0)
+                printf("Evolving GoL's chunks with %s kernels\n\n", SIMD_NAMES[level]);
+            break;
+        }
+        case ENGINE_LUT:
+            init_lut();
+            break;
+        case ENGINE_COLSUM:
+            init_colsum(chunk->ncols);
+            break;
+        default:
+            break;
+    }
+}
+
+/**
+ * Free the data structures of a chunk's evolution engine, if any.
+ */
+void engine_cleanup_chunk(chunk_t *chunk) {
+    switch (chunk->engine) {
+        case ENGINE_COLSUM:
+            cleanup_colsum();
+            break;
+        default:
+            break;
+    }
+}
+
+/**
+ * Evolve the rows in [from, to) of a chunk with its evolution engine, once its ghost cells are up to date. Rows are written to
+ * the next slice, so that a generation can be split into several calls.
+ */
+void engine_evolve_chunk(chunk_t *chunk, int from, int to) {
+    switch (chunk->engine) {
+        case ENGINE_PADDED:
+            evolve_chunk_padded(chunk, from, to);
+            break;
+        case ENGINE_SIMD:
+            evolve_chunk_simd(chunk, from, to);
+            break;
+        case ENGINE_LUT:
+            evolve_chunk_lut(chunk, from, to);
+            break;
+        case ENGINE_COLSUM:
+            evolve_chunk_colsum(chunk, from, to);
+            break;
+        default:
+            evolve_chunk(chunk, from, to);
+    }
+}
+#endif
+
+#endif
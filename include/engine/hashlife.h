@@ -0,0 +1,601 @@
+#ifndef GoL_ENGINE_HASHLIFE_H
+#define GoL_ENGINE_HASHLIFE_H
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+// Custom includes
+#include "../globals.h"
+#include "../life/life.h"
+#include "lut.h"
+
+/**
+ * Node of a canonical quadtree: a node of level k is a square of 2^k x 2^k cells, split into four quadrants of level k - 1.
+ * Leaves, of level 0, are single cells. Nodes are hash-consed, i.e., there is exactly one node for any given four quadrants,
+ * thus equal regions of the board, wherever and whenever they occur, are the very same node.
+ */
+typedef struct hl_node {
+    struct hl_node *nw, *ne; // Top quadrants, or NULL for leaves
+    struct hl_node *sw, *se; // Bottom quadrants, or NULL for leaves
+
+    struct hl_node *result;  // Centre of the node advanced by 2^result_k generations, or NULL if not cached
+    struct hl_node *next;    // Next node in the same bucket of the hash table
+
+    int8_t level;            // log2 of the side of the node
+    int8_t result_k;         // log2 of the generations result has been advanced by
+    bool marked;             // Whether the node is reachable, during garbage collection
+} hl_node_t;
+
+/**
+ * HashLife universe: the hash table of all nodes, along with the roots that garbage collection has to keep.
+ */
+typedef struct hashlife {
+    hl_node_t dead;          // DEAD leaf
+    hl_node_t alive;         // ALIVE leaf
+
+    hl_node_t **buckets;     // Hash table of all nodes but leaves
+    size_t nbuckets;         // Number of buckets, a power of 2
+
+    size_t nnodes;           // Number of nodes in the hash table
+    size_t peak_nodes;       // Largest number of nodes in the hash table so far
+    size_t max_nodes;        // Number of nodes that fit in the memory cap
+    size_t gc_threshold;     // Number of nodes that triggers the next garbage collection
+
+    hl_node_t **roots;       // Stack of nodes in use by the ongoing evolution
+    size_t nroots;           // Number of nodes in the stack
+    size_t roots_size;       // Capacity of the stack
+
+    long long hits;          // Number of results found in the cache
+    long long misses;        // Number of results not found in the cache
+    int ngc;                 // Number of garbage collections so far
+} hashlife_t;
+
+/**
+ * Periodic tiling of GoL's board that a level-L root is built from, with the top-left cell at (r0, c0).
+ *
+ * The block of level j with index (a, b) starts at (r0 + a * 2^j, c0 + b * 2^j). As the board is toroidal, two blocks with indices
+ * that are equal modulo nrows / gcd(nrows, 2^j) and ncols / gcd(ncols, 2^j) hold the same cells, thus they are built only once.
+ */
+typedef struct hl_tiling {
+    long long r0, c0;        // Top-left cell of the root, possibly outside the board
+    int level;               // Level of the root
+
+    hl_node_t ***blocks;     // Blocks built so far, per level
+    long long *nrows;        // Number of distinct block rows, per level
+    long long *ncols;        // Number of distinct block columns, per level
+} hl_tiling_t;
+
+// Level of the smallest blocks hl_tiling_t keeps track of, which are built cell by cell
+const int HL_TILING_LEVEL = 3;
+
+/**
+ * Hash of the four quadrants of a node.
+ */
+static inline size_t hl_hash(hl_node_t *nw, hl_node_t *ne,
+        hl_node_t *sw, hl_node_t *se) {
+    uint64_t h = (uintptr_t) nw;
+
+    h = h * 0x9E3779B97F4A7C15ULL + (uintptr_t) ne;
+    h = h * 0x9E3779B97F4A7C15ULL + (uintptr_t) sw;
+    h = h * 0x9E3779B97F4A7C15ULL + (uintptr_t) se;
+
+    return (size_t) (h ^ (h >> 29));
+}
+
+/**
+ * Double the buckets of the hash table, once it holds more nodes than buckets.
+ */
+void hl_grow(hashlife_t *hl) {
+    size_t b;
+
+    size_t nbuckets = hl->nbuckets * 2;
+
+    hl_node_t **buckets = (hl_node_t **) calloc(nbuckets, sizeof(hl_node_t *));
+
+    if (buckets == NULL) {
+        perror("[*] HashLife's hash table allocation failed!\n");
+        exit(EXIT_FAILURE);
+    }
+
+    for (b = 0; b < hl->nbuckets; b++) {
+        hl_node_t *node = hl->buckets[b];
+
+        while (node != NULL) {
+            hl_node_t *next = node->next;
+            size_t h = hl_hash(node->nw, node->ne, node->sw, node->se) & (nbuckets - 1);
+
+            node->next = buckets[h];
+            buckets[h] = node;
+
+            node = next;
+        }
+    }
+
+    free(hl->buckets);
+
+    hl->buckets  = buckets;
+    hl->nbuckets = nbuckets;
+}
+
+/**
+ * Find the canonical node with the given quadrants, creating it if it does not exist yet.
+ */
+hl_node_t* hl_find(hashlife_t *hl, hl_node_t *nw, hl_node_t *ne,
+        hl_node_t *sw, hl_node_t *se) {
+    size_t h = hl_hash(nw, ne, sw, se) & (hl->nbuckets - 1);
+
+    hl_node_t *node;
+
+    for (node = hl->buckets[h]; node != NULL; node = node->next)
+        if (node->nw == nw && node->ne == ne
+                && node->sw == sw && node->se == se)
+            return node;
+
+    node = (hl_node_t *) malloc(sizeof(hl_node_t));
+
+    if (node == NULL) {
+        perror("[*] HashLife's node allocation failed!\n");
+        exit(EXIT_FAILURE);
+    }
+
+    node->nw = nw;
+    node->ne = ne;
+    node->sw = sw;
+    node->se = se;
+
+    node->result   = NULL;
+    node->level    = nw->level + 1;
+    node->result_k = -1;
+    node->marked   = false;
+
+    node->next     = hl->buckets[h];
+    hl->buckets[h] = node;
+
+    if (++hl->nnodes > hl->peak_nodes)
+        hl->peak_nodes = hl->nnodes;
+
+    if (hl->nnodes > hl->nbuckets)
+        hl_grow(hl);
+
+    return node;
+}
+
+/**
+ * Push a node onto the stack of roots, so that garbage collection keeps it.
+ */
+void hl_push(hashlife_t *hl, hl_node_t *node) {
+    if (hl->nroots == hl->roots_size) {
+        hl->roots_size *= 2;
+        hl->roots = (hl_node_t **) realloc(hl->roots, sizeof(hl_node_t *) * hl->roots_size);
+
+        if (hl->roots == NULL) {
+            perror("[*] HashLife's roots allocation failed!\n");
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    hl->roots[hl->nroots++] = node;
+}
+
+/**
+ * Mark a node as reachable, along with its quadrants and its cached result, so that the ongoing evolution keeps its cache.
+ */
+void hl_mark(hl_node_t *node) {
+    if (node->level == 0 || node->marked)
+        return;
+
+    node->marked = true;
+
+    hl_mark(node->nw);
+    hl_mark(node->ne);
+    hl_mark(node->sw);
+    hl_mark(node->se);
+
+    if (node->result != NULL)
+        hl_mark(node->result);
+}
+
+/**
+ * Free all nodes that are not reachable from the stack of roots, together with their cached results.
+ */
+void hl_gc(hashlife_t *hl) {
+    size_t b, r;
+
+    // 1. Mark all nodes reachable from the roots
+    for (r = 0; r < hl->nroots; r++)
+        hl_mark(hl->roots[r]);
+
+    // 2. Sweep all unmarked nodes
+    for (b = 0; b < hl->nbuckets; b++) {
+        hl_node_t **link = &hl->buckets[b];
+
+        while (*link != NULL) {
+            hl_node_t *node = *link;
+
+            if (node->marked) {
+                node->marked = false;
+                link = &node->next;
+            } else {
+                *link = node->next;
+                free(node);
+                hl->nnodes--;
+            }
+        }
+    }
+
+    hl->ngc++;
+
+    // If the roots alone fill most of the memory cap, let the hash table grow past it rather than collecting at every step
+    if (hl->nnodes > hl->max_nodes / 2) {
+        if (hl->gc_threshold == hl->max_nodes)
+            printf("[*] HashLife's nodes in use exceed half the memory cap of %d MB\n", DEFAULT_HASHLIFE_MEMORY);
+
+        hl->gc_threshold = hl->nnodes + hl->max_nodes / 2;
+    } else
+        hl->gc_threshold = hl->max_nodes;
+}
+
+/**
+ * Centre of a node of level k >= 2, i.e., a node of level k - 1, at the same generation.
+ */
+static inline hl_node_t* hl_centre(hashlife_t *hl, hl_node_t *node) {
+    return hl_find(hl, node->nw->se, node->ne->sw,
+            node->sw->ne, node->se->nw);
+}
+
+/**
+ * Advance the centre of a node of level 2 by one generation, with the lookup table of the lut engine.
+ */
+hl_node_t* hl_base(hashlife_t *hl, hl_node_t *node) {
+    int r, c;
+
+    hl_node_t *quads[2][2] = {
+        { node->nw, node->ne },
+        { node->sw, node->se }
+    };
+
+    unsigned int key = 0;
+
+    for (r = 0; r < 4; r++)
+        for (c = 0; c < 4; c++) {
+            hl_node_t *quad = quads[r / 2][c / 2];
+            hl_node_t *cell = (r % 2 == 0) \
+                ? ((c % 2 == 0) ? quad->nw : quad->ne) \
+                : ((c % 2 == 0) ? quad->sw : quad->se);
+
+            key |= (unsigned int) (cell == &hl->alive) << (15 - (4*r + c));
+        }
+
+    uint8_t next = LUT[key];
+
+    return hl_find(hl,
+            (next & 1)      ? &hl->alive : &hl->dead,
+            (next >> 1 & 1) ? &hl->alive : &hl->dead,
+            (next >> 2 & 1) ? &hl->alive : &hl->dead,
+            (next >> 3 & 1) ? &hl->alive : &hl->dead);
+}
+
+/**
+ * Advance the centre of a node of level L by 2^k generations, with 0 <= k <= L - 2, caching the result in the node.
+ *
+ * The node is split into 9 overlapping sub-nodes of level L - 1. If k = L - 2, each of them is advanced by 2^(L - 3) generations
+ * first, otherwise only its centre is taken. The results are then combined into 4 overlapping nodes of level L - 1, which are advanced
+ * by the remaining generations. The caller must have pushed the node onto the stack of roots, as garbage collection may take place.
+ */
+hl_node_t* hl_result(hashlife_t *hl, hl_node_t *node, int k) {
+    int i;
+
+    if (node->result != NULL
+            && node->result_k == k) {
+        hl->hits++;
+        return node->result;
+    }
+
+    hl->misses++;
+
+    if (hl->nnodes > hl->gc_threshold)
+        hl_gc(hl);
+
+    hl_node_t *result;
+
+    if (node->level == 2) {
+        result = hl_base(hl, node);
+    } else {
+        size_t nroots = hl->nroots;
+
+        bool full = (k == node->level - 2);
+
+        hl_node_t *nw = node->nw, *ne = node->ne;
+        hl_node_t *sw = node->sw, *se = node->se;
+
+        // 1. Split the node into 9 overlapping sub-nodes, row by row
+        hl_node_t *sub[9] = {
+            nw,
+            hl_find(hl, nw->ne, ne->nw, nw->se, ne->sw),
+            ne,
+            hl_find(hl, nw->sw, nw->se, sw->nw, sw->ne),
+            hl_find(hl, nw->se, ne->sw, sw->ne, se->nw),
+            hl_find(hl, ne->sw, ne->se, se->nw, se->ne),
+            sw,
+            hl_find(hl, sw->ne, se->nw, sw->se, se->sw),
+            se
+        };
+
+        for (i = 0; i < 9; i++)
+            hl_push(hl, sub[i]);
+
+        // 2. Advance each of them by 2^(L - 3) generations, or take its centre
+        for (i = 0; i < 9; i++) {
+            sub[i] = full \
+                ? hl_result(hl, sub[i], k - 1) \
+                : hl_centre(hl, sub[i]);
+
+            hl_push(hl, sub[i]);
+        }
+
+        // 3. Combine them into 4 overlapping nodes, and advance these by the remaining generations
+        hl_node_t *quad[4] = {
+            hl_find(hl, sub[0], sub[1], sub[3], sub[4]),
+            hl_find(hl, sub[1], sub[2], sub[4], sub[5]),
+            hl_find(hl, sub[3], sub[4], sub[6], sub[7]),
+            hl_find(hl, sub[4], sub[5], sub[7], sub[8])
+        };
+
+        for (i = 0; i < 4; i++)
+            hl_push(hl, quad[i]);
+
+        for (i = 0; i < 4; i++) {
+            quad[i] = hl_result(hl, quad[i], full ? k - 1 : k);
+            hl_push(hl, quad[i]);
+        }
+
+        result = hl_find(hl, quad[0], quad[1], quad[2], quad[3]);
+
+        hl->nroots = nroots;
+    }
+
+    node->result   = result;
+    node->result_k = k;
+
+    return result;
+}
+
+/**
+ * Build the node of the given level whose top-left cell is (r, c) of GoL's board, wrapping around its borders, cell by cell.
+ */
+hl_node_t* hl_build_cells(hashlife_t *hl, life_t *life,
+        int level, long long r, long long c) {
+    if (level == 0) {
+        int i = (int) (((r % life->nrows) + life->nrows) % life->nrows);
+        int j = (int) (((c % life->ncols) + life->ncols) % life->ncols);
+
+        return life->grid[i][j] == ALIVE ? &hl->alive : &hl->dead;
+    }
+
+    long long half = 1LL << (level - 1);
+
+    return hl_find(hl,
+            hl_build_cells(hl, life, level - 1, r, c),
+            hl_build_cells(hl, life, level - 1, r, c + half),
+            hl_build_cells(hl, life, level - 1, r + half, c),
+            hl_build_cells(hl, life, level - 1, r + half, c + half));
+}
+
+/**
+ * Build the block of the tiling with the given level and index (a, b), reusing the blocks that have already been built.
+ */
+hl_node_t* hl_build(hashlife_t *hl, life_t *life, hl_tiling_t *tiling,
+        int level, long long a, long long b) {
+    hl_node_t **block = &tiling->blocks[level][(a % tiling->nrows[level]) * tiling->ncols[level]
+            + (b % tiling->ncols[level])];
+
+    if (*block != NULL)
+        return *block;
+
+    if (level == HL_TILING_LEVEL)
+        *block = hl_build_cells(hl, life, level,
+                tiling->r0 + (a << level), tiling->c0 + (b << level));
+    else
+        *block = hl_find(hl,
+                hl_build(hl, life, tiling, level - 1, 2*a, 2*b),
+                hl_build(hl, life, tiling, level - 1, 2*a, 2*b + 1),
+                hl_build(hl, life, tiling, level - 1, 2*a + 1, 2*b),
+                hl_build(hl, life, tiling, level - 1, 2*a + 1, 2*b + 1));
+
+    return *block;
+}
+
+long long gcd_pow2(long long n, int level) {
+    long long g = 1;
+
+    while (level-- > 0 && n % (g * 2) == 0)
+        g *= 2;
+
+    return g;
+}
+
+/**
+ * Build the root of the given level out of the periodic tiling of GoL's board, such that the board's top-left cell lies at
+ * the top-left corner of the root's centre.
+ */
+hl_node_t* hl_build_root(hashlife_t *hl, life_t *life, int level) {
+    int j;
+
+    hl_tiling_t tiling;
+
+    tiling.level = level;
+    tiling.r0    = -(1LL << (level - 2));
+    tiling.c0    = -(1LL << (level - 2));
+
+    tiling.blocks = (hl_node_t ***) calloc(level + 1, sizeof(hl_node_t **));
+    tiling.nrows  = (long long *) calloc(level + 1, sizeof(long long));
+    tiling.ncols  = (long long *) calloc(level + 1, sizeof(long long));
+
+    if (tiling.blocks == NULL || tiling.nrows == NULL
+            || tiling.ncols == NULL) {
+        perror("[*] HashLife's tiling allocation failed!\n");
+        exit(EXIT_FAILURE);
+    }
+
+    for (j = HL_TILING_LEVEL; j <= level; j++) {
+        long long nblocks = 1LL << (level - j);
+
+        long long nrows = life->nrows / gcd_pow2(life->nrows, j);
+        long long ncols = life->ncols / gcd_pow2(life->ncols, j);
+
+        tiling.nrows[j] = nrows < nblocks ? nrows : nblocks;
+        tiling.ncols[j] = ncols < nblocks ? ncols : nblocks;
+
+        tiling.blocks[j] = (hl_node_t **) calloc(tiling.nrows[j] * tiling.ncols[j], sizeof(hl_node_t *));
+
+        if (tiling.blocks[j] == NULL) {
+            perror("[*] HashLife's tiling allocation failed!\n");
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    hl_node_t *root = hl_build(hl, life, &tiling, level, 0, 0);
+
+    for (j = HL_TILING_LEVEL; j <= level; j++)
+        free(tiling.blocks[j]);
+
+    free(tiling.blocks);
+    free(tiling.nrows);
+    free(tiling.ncols);
+
+    return root;
+}
+
+/**
+ * Write the cells of a node of the given level, whose top-left cell is (r, c), to GoL's board, skipping those outside of it.
+ */
+void hl_extract(hashlife_t *hl, life_t *life, hl_node_t *node,
+        int level, long long r, long long c) {
+    if (r >= life->nrows || c >= life->ncols)
+        return;
+
+    if (level == 0) {
+        life->grid[r][c] = (node == &hl->alive) ? ALIVE : DEAD;
+        return;
+    }
+
+    long long half = 1LL << (level - 1);
+
+    hl_extract(hl, life, node->nw, level - 1, r, c);
+    hl_extract(hl, life, node->ne, level - 1, r, c + half);
+    hl_extract(hl, life, node->sw, level - 1, r + half, c);
+    hl_extract(hl, life, node->se, level - 1, r + half, c + half);
+}
+
+void init_hashlife(life_t *life) {
+    hashlife_t *hl = (hashlife_t *) calloc(1, sizeof(hashlife_t));
+
+    if (hl == NULL) {
+        perror("[*] HashLife's universe allocation failed!\n");
+        exit(EXIT_FAILURE);
+    }
+
+    hl->dead.level  = 0;
+    hl->alive.level = 0;
+
+    hl->nbuckets = 1 << 16;
+    hl->buckets  = (hl_node_t **) calloc(hl->nbuckets, sizeof(hl_node_t *));
+
+    hl->roots_size = 256;
+    hl->roots      = (hl_node_t **) malloc(sizeof(hl_node_t *) * hl->roots_size);
+
+    if (hl->buckets == NULL || hl->roots == NULL) {
+        perror("[*] HashLife's universe allocation failed!\n");
+        exit(EXIT_FAILURE);
+    }
+
+    hl->max_nodes    = ((size_t) DEFAULT_HASHLIFE_MEMORY << 20) / (sizeof(hl_node_t) + sizeof(hl_node_t *));
+    hl->gc_threshold = hl->max_nodes;
+
+    // Level-2 nodes are advanced with the lookup table
+    init_lut();
+
+    life->engine_state = hl;
+}
+
+/**
+ * Perform as many evolutionary steps of the board as the largest power of 2 not exceeding max_steps, with HashLife.
+ *
+ * The board is toroidal, thus a root of level L is built out of the periodic tiling of the board, large enough that both its centre
+ * covers the whole board and it can be advanced by 2^k generations, i.e., 2^(L - 1) >= nrows, ncols and L >= k + 2. The advanced
+ * centre then holds the board at 2^k generations later, starting from its top-left corner.
+ *
+ * @return steps    The number of generations the board has been advanced by.
+ */
+int evolve_hashlife(life_t *life, int max_steps) {
+    hashlife_t *hl = (hashlife_t *) life->engine_state;
+
+    // 1. Pick the largest jump of 2^k generations, and the smallest root level that allows for it
+    int k = 0;
+
+    while (k < 30 && (2LL << k) <= max_steps)
+        k++;
+
+    int level = HL_TILING_LEVEL;
+
+    while ((1LL << (level - 1)) < life->nrows
+            || (1LL << (level - 1)) < life->ncols
+            || level < k + 2)
+        level++;
+
+    // 2. Build the root, and advance its centre
+    hl_node_t *root = hl_build_root(hl, life, level);
+
+    hl_push(hl, root);
+
+    hl_node_t *result = hl_result(hl, root, k);
+
+    hl->nroots = 0;
+
+    // 3. Write the advanced centre back to the board
+    hl_extract(hl, life, result, level - 1, 0, 0);
+
+    return 1 << k;
+}
+
+/**
+ * Print to console the cache hit rate and the node count of HashLife, so as to size its memory cap.
+ */
+void report_hashlife(life_t life) {
+    hashlife_t *hl = (hashlife_t *) life.engine_state;
+
+    long long lookups = hl->hits + hl->misses;
+
+    printf("HashLife's cache: %lld hits out of %lld lookups - %.2f%%\n",
+            hl->hits, lookups, lookups > 0 ? 100. * hl->hits / lookups : 0.);
+
+    printf("HashLife's nodes: %zu in use, %zu at peak, %zu at most - %zu bytes each, %d garbage collections\n",
+            hl->nnodes, hl->peak_nodes, hl->max_nodes,
+            sizeof(hl_node_t) + sizeof(hl_node_t *), hl->ngc);
+}
+
+void cleanup_hashlife(life_t *life) {
+    size_t b;
+
+    hashlife_t *hl = (hashlife_t *) life->engine_state;
+
+    for (b = 0; b < hl->nbuckets; b++) {
+        hl_node_t *node = hl->buckets[b];
+
+        while (node != NULL) {
+            hl_node_t *next = node->next;
+
+            free(node);
+            node = next;
+        }
+    }
+
+    free(hl->buckets);
+    free(hl->roots);
+    free(hl);
+
+    life->engine_state = NULL;
+}
+
+#endif
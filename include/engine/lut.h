@@ -0,0 +1,159 @@
+#ifndef GoL_ENGINE_LUT_H
+#define GoL_ENGINE_LUT_H
+
+#include <stdint.h>
+
+// Custom includes
+#include "../globals.h"
+#include "../life/life.h"
+#include "../utils/frame.h"
+
+#ifdef GoL_MPI
+#include "../chunk/chunk.h"
+#endif
+
+/*
+ * Lookup table from every 4x4 window of cells to the next state of its 2x2 centre.
+ *
+ * The key of a window packs its 16 cells row by row, top-left cell first, from the most to the least significant bit: that is,
+ * cell (r, c) is bit 15 - (4r + c). The value packs the next state of the centre cells (1, 1), (1, 2), (2, 1) and (2, 2),
+ * from the least to the most significant bit. The whole table takes 64 KB, hence it fits in L2.
+ */
+uint8_t LUT[1 << 16];
+
+bool lut_ready = false; // Whether LUT has already been built
+
+/**
+ * Evaluate the next state of cell (r, c) of a 4x4 window, with 1 <= r, c <= 2, by applying GoL rules.
+ */
+bool lut_cell(unsigned int key, int r, int c) {
+    int i, j;
+
+    int alive_neighbs = 0;
+
+    for (i = r - 1; i <= r + 1; i++)
+        for (j = c - 1; j <= c + 1; j++)
+            if (!(i == r && j == c))
+                alive_neighbs += (key >> (15 - (4*i + j))) & 1;
+
+    bool alive = (key >> (15 - (4*r + c))) & 1;
+
+    return alive_neighbs == 3
+            || (alive_neighbs == 2 && alive);
+}
+
+/**
+ * Build the lookup table once, before GoL's evolution starts.
+ */
+void init_lut() {
+    unsigned int key;
+
+    if (lut_ready)
+        return;
+
+    for (key = 0; key < (1 << 16); key++)
+        LUT[key] = lut_cell(key, 1, 1)
+                | lut_cell(key, 1, 2) << 1
+                | lut_cell(key, 2, 1) << 2
+                | lut_cell(key, 2, 2) << 3;
+
+    lut_ready = true;
+}
+
+/**
+ * Bits of the key contributed by a column of a 4x4 window, given the four rows it spans. They sit in the least significant bit of each nibble.
+ */
+static inline unsigned int lut_col(const bool *r0, const bool *r1,
+        const bool *r2, const bool *r3, int j) {
+    return r0[j] << 12 | r1[j] << 8 | r2[j] << 4 | r3[j];
+}
+
+/**
+ * Evolve a pair of rows of a board whose ghost columns are up to date, 2x2 cells at a time, given the rows above and below them.
+ *
+ * Moving along the rows, the window slides 2 columns to the right: the key only needs to shift its two rightmost columns
+ * to the left and to load 2 new columns, thus every cell is loaded twice rather than nine times.
+ *
+ * @param r0, r1, r2, r3    The row above, the two rows to evolve, and the row below.
+ *
+ * @param out1              The next state of r2, or NULL if only r1 has to be evolved; in that case, r3 is never used.
+ */
+void evolve_lut_pair(const bool *r0, const bool *r1, const bool *r2,
+        const bool *r3, bool *out0, bool *out1, int ncols) {
+    int j;
+
+    // The left ghost column and the 1st one, which the 1st window will shift to its leftmost columns
+    unsigned int key = lut_col(r0, r1, r2, r3, -1) << 1
+            | lut_col(r0, r1, r2, r3, 0);
+
+    for (j = 0; j < ncols; j += 2) {
+        // 1. Slide the window by 2 columns. With an odd # of columns, the last window would reach past the right ghost column,
+        // which is never allocated: leave that column DEAD, as it only affects a cell outside the board.
+        key = (key << 2 & 0xCCCC) | lut_col(r0, r1, r2, r3, j + 1) << 1;
+
+        if (j + 1 < ncols)
+            key |= lut_col(r0, r1, r2, r3, j + 2);
+
+        // 2. Look up the next state of the centre
+        uint8_t next = LUT[key];
+
+        out0[j] = next & 1;
+
+        if (out1 != NULL)
+            out1[j] = next >> 2 & 1;
+
+        if (j + 1 < ncols) {
+            out0[j + 1] = next >> 1 & 1;
+
+            if (out1 != NULL)
+                out1[j + 1] = next >> 3 & 1;
+        }
+    }
+}
+
+/**
+ * Evolve the rows in [from, to) of a board whose ghost cells are up to date, two rows at a time.
+ */
+void evolve_lut_rows(bool **grid, bool **next_grid,
+        int from, int to, int ncols) {
+    int i;
+
+    #ifdef _OPENMP
+    #pragma omp parallel for
+    #endif
+    for (i = from; i < to; i += 2) {
+        if (i + 1 < to)
+            evolve_lut_pair(grid[i - 1], grid[i], grid[i + 1], grid[i + 2],
+                    next_grid[i], next_grid[i + 1], ncols);
+        else // An odd # of rows leaves the last one out
+            evolve_lut_pair(grid[i - 1], grid[i], grid[i + 1], grid[i + 1],
+                    next_grid[i], NULL, ncols);
+    }
+}
+
+/**
+ * Perform one evolutionary step of the board with table lookups on 2x2 cells at a time.
+ */
+void evolve_lut(life_t *life) {
+    // 1. Refresh the ghost frame
+    wrap_frame(life->grid, life->nrows, life->ncols, 1);
+
+    // 2. Evolve every cell in the grid
+    evolve_lut_rows(life->grid, life->next_grid,
+            0, life->nrows, life->ncols);
+
+    // 3. Replace the old grid with the updated one
+    swap_grids(&life->grid, &life->next_grid);
+}
+
+#ifdef GoL_MPI
+/**
+ * Evolve the rows in [from, to) of a chunk with table lookups on 2x2 cells at a time, once its ghost cells are up to date.
+ */
+void evolve_chunk_lut(chunk_t *chunk, int from, int to) {
+    evolve_lut_rows(chunk->slice, chunk->next_slice,
+            from, to, chunk->ncols);
+}
+#endif
+
+#endif
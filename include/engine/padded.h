@@ -0,0 +1,90 @@
+#ifndef GoL_ENGINE_PADDED_H
+#define GoL_ENGINE_PADDED_H
+
+// Custom includes
+#include "../globals.h"
+#include "../life/life.h"
+#include "../utils/frame.h"
+
+#ifdef GoL_MPI
+#include "../chunk/chunk.h"
+#endif
+
+/**
+ * Evolve one row of a board surrounded by ghost cells, given the rows above and below it.
+ *
+ * Neighbours are read at offsets -1 and +1 with no modulo and no branches, so that the compiler is free to vectorize the loop.
+ */
+static inline void evolve_padded_row(const bool *restrict up, const bool *restrict mid,
+        const bool *restrict down, bool *restrict next, int ncols) {
+    int j;
+
+    for (j = 0; j < ncols; j++) {
+        int alive_neighbs = up[j - 1]   + up[j]   + up[j + 1]
+                          + mid[j - 1]            + mid[j + 1]
+                          + down[j - 1] + down[j] + down[j + 1];
+
+        next[j] = (alive_neighbs == 3) | ((alive_neighbs == 2) & mid[j]);
+    }
+}
+
+/**
+ * Any function that evolves one row of a board surrounded by ghost cells, given the rows above and below it, like evolve_padded_row().
+ */
+typedef void (*row_kernel_t)(const bool *up, const bool *mid,
+        const bool *down, bool *next, int ncols);
+
+/**
+ * Perform one evolutionary step of the board, following GoL rules, on the ghost-padded layout:
+ *     1. Refresh the ghost frame once, by wrapping around the board's borders;
+ *     2. Evolve every row with the given row kernel, with no toroidal index arithmetic.
+ */
+void evolve_padded_with(life_t *life, row_kernel_t kernel) {
+    int i;
+
+    int ncols = life->ncols;
+    int nrows = life->nrows;
+
+    // 1. Refresh the ghost frame
+    wrap_frame(life->grid, nrows, ncols, 1);
+
+    // 2. Evolve every cell in the grid
+    #ifdef _OPENMP
+    #pragma omp parallel for
+    #endif
+    for (i = 0; i < nrows; i++)
+        kernel(life->grid[i - 1], life->grid[i], life->grid[i + 1],
+                life->next_grid[i], ncols);
+
+    // 3. Replace the old grid with the updated one
+    swap_grids(&life->grid, &life->next_grid);
+}
+
+void evolve_padded(life_t *life) {
+    evolve_padded_with(life, evolve_padded_row);
+}
+
+#ifdef GoL_MPI
+/**
+ * Evolve the rows in [from, to) of a chunk on the ghost-padded layout with the given row kernel, once its ghost cells are up to date.
+ * Ghost rows are shared by neighbour processes, whereas ghost columns wrap around the chunk's own rows, as data is split on rows.
+ */
+void evolve_chunk_padded_with(chunk_t *chunk, int from, int to, row_kernel_t kernel) {
+    int i;
+
+    int ncols = chunk->ncols;
+
+    #ifdef _OPENMP
+    #pragma omp parallel for
+    #endif
+    for (i = from; i < to; i++)
+        kernel(chunk->slice[i - 1], chunk->slice[i], chunk->slice[i + 1],
+                chunk->next_slice[i], ncols);
+}
+
+void evolve_chunk_padded(chunk_t *chunk, int from, int to) {
+    evolve_chunk_padded_with(chunk, from, to, evolve_padded_row);
+}
+#endif
+
+#endif
@@ -0,0 +1,256 @@
+#ifndef GoL_ENGINE_SIMD_H
+#define GoL_ENGINE_SIMD_H
+
+#include <stdio.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#define GoL_X86 // Enable hand-written SIMD kernels
+
+#include <cpuid.h>
+#include <immintrin.h>
+#endif
+
+// Custom includes
+#include "../globals.h"
+#include "../life/life.h"
+#include "padded.h"
+
+#ifdef GoL_MPI
+#include "../chunk/chunk.h"
+#endif
+
+/*
+ * Each kernel is compiled for its own instruction set, regardless of the compilation flags, so that a single binary can pick the widest
+ * one the running CPU supports. ICC does not need the target attribute, as it accepts any intrinsic by default.
+ */
+#if defined(__GNUC__) && !defined(__INTEL_COMPILER)
+#define GoL_TARGET(isa) __attribute__((target(isa)))
+#else
+#define GoL_TARGET(isa)
+#endif
+
+// Instruction sets the SIMD kernels are available for, from the narrowest to the widest
+enum SimdLevels {
+    SIMD_SCALAR,
+    SIMD_SSE42,
+    SIMD_AVX2,
+    SIMD_AVX512,
+    NUM_SIMD_LEVELS
+};
+
+const char *SIMD_NAMES[NUM_SIMD_LEVELS] = {
+    "scalar",
+    "SSE4.2",
+    "AVX2",
+    "AVX-512"
+};
+
+// Row kernel picked at startup by init_simd()
+row_kernel_t simd_kernel = NULL;
+
+#ifdef GoL_X86
+/*
+ * All kernels below follow evolve_padded_row(), one byte per cell, on as many cells at once as a vector register holds:
+ *     1. Sum the 8 neighbours of every cell with byte-wise additions of unaligned loads at offsets -1, 0 and +1;
+ *     2. A cell is ALIVE at the next step iff the sum is 3, or it is 2 and the cell is ALIVE.
+ *
+ * Cells that do not fill a whole register are evolved by the scalar kernel.
+ */
+
+GoL_TARGET("sse4.2")
+void evolve_row_sse42(const bool *up, const bool *mid,
+        const bool *down, bool *next, int ncols) {
+    int j;
+
+    const __m128i one   = _mm_set1_epi8(1);
+    const __m128i two   = _mm_set1_epi8(2);
+    const __m128i three = _mm_set1_epi8(3);
+
+    for (j = 0; j + 16 <= ncols; j += 16) {
+        __m128i sum = _mm_add_epi8(
+                _mm_add_epi8(
+                    _mm_add_epi8(_mm_loadu_si128((const __m128i *) (up + j - 1)),
+                                 _mm_loadu_si128((const __m128i *) (up + j))),
+                    _mm_add_epi8(_mm_loadu_si128((const __m128i *) (up + j + 1)),
+                                 _mm_loadu_si128((const __m128i *) (mid + j - 1)))),
+                _mm_add_epi8(
+                    _mm_add_epi8(_mm_loadu_si128((const __m128i *) (mid + j + 1)),
+                                 _mm_loadu_si128((const __m128i *) (down + j - 1))),
+                    _mm_add_epi8(_mm_loadu_si128((const __m128i *) (down + j)),
+                                 _mm_loadu_si128((const __m128i *) (down + j + 1)))));
+
+        __m128i cur = _mm_loadu_si128((const __m128i *) (mid + j));
+
+        __m128i born = _mm_and_si128(_mm_cmpeq_epi8(sum, three), one);
+        __m128i stay = _mm_and_si128(_mm_cmpeq_epi8(sum, two), cur);
+
+        _mm_storeu_si128((__m128i *) (next + j), _mm_or_si128(born, stay));
+    }
+
+    evolve_padded_row(up + j, mid + j, down + j, next + j, ncols - j);
+}
+
+GoL_TARGET("avx2")
+void evolve_row_avx2(const bool *up, const bool *mid,
+        const bool *down, bool *next, int ncols) {
+    int j;
+
+    const __m256i one   = _mm256_set1_epi8(1);
+    const __m256i two   = _mm256_set1_epi8(2);
+    const __m256i three = _mm256_set1_epi8(3);
+
+    for (j = 0; j + 32 <= ncols; j += 32) {
+        __m256i sum = _mm256_add_epi8(
+                _mm256_add_epi8(
+                    _mm256_add_epi8(_mm256_loadu_si256((const __m256i *) (up + j - 1)),
+                                    _mm256_loadu_si256((const __m256i *) (up + j))),
+                    _mm256_add_epi8(_mm256_loadu_si256((const __m256i *) (up + j + 1)),
+                                    _mm256_loadu_si256((const __m256i *) (mid + j - 1)))),
+                _mm256_add_epi8(
+                    _mm256_add_epi8(_mm256_loadu_si256((const __m256i *) (mid + j + 1)),
+                                    _mm256_loadu_si256((const __m256i *) (down + j - 1))),
+                    _mm256_add_epi8(_mm256_loadu_si256((const __m256i *) (down + j)),
+                                    _mm256_loadu_si256((const __m256i *) (down + j + 1)))));
+
+        __m256i cur = _mm256_loadu_si256((const __m256i *) (mid + j));
+
+        __m256i born = _mm256_and_si256(_mm256_cmpeq_epi8(sum, three), one);
+        __m256i stay = _mm256_and_si256(_mm256_cmpeq_epi8(sum, two), cur);
+
+        _mm256_storeu_si256((__m256i *) (next + j), _mm256_or_si256(born, stay));
+    }
+
+    evolve_padded_row(up + j, mid + j, down + j, next + j, ncols - j);
+}
+
+GoL_TARGET("avx512f,avx512bw")
+void evolve_row_avx512(const bool *up, const bool *mid,
+        const bool *down, bool *next, int ncols) {
+    int j;
+
+    const __m512i one   = _mm512_set1_epi8(1);
+    const __m512i two   = _mm512_set1_epi8(2);
+    const __m512i three = _mm512_set1_epi8(3);
+
+    for (j = 0; j + 64 <= ncols; j += 64) {
+        __m512i sum = _mm512_add_epi8(
+                _mm512_add_epi8(
+                    _mm512_add_epi8(_mm512_loadu_si512((const void *) (up + j - 1)),
+                                    _mm512_loadu_si512((const void *) (up + j))),
+                    _mm512_add_epi8(_mm512_loadu_si512((const void *) (up + j + 1)),
+                                    _mm512_loadu_si512((const void *) (mid + j - 1)))),
+                _mm512_add_epi8(
+                    _mm512_add_epi8(_mm512_loadu_si512((const void *) (mid + j + 1)),
+                                    _mm512_loadu_si512((const void *) (down + j - 1))),
+                    _mm512_add_epi8(_mm512_loadu_si512((const void *) (down + j)),
+                                    _mm512_loadu_si512((const void *) (down + j + 1)))));
+
+        __m512i cur = _mm512_loadu_si512((const void *) (mid + j));
+
+        __mmask64 alive = _mm512_cmpeq_epi8_mask(sum, three)
+                | (_mm512_cmpeq_epi8_mask(sum, two) & _mm512_test_epi8_mask(cur, cur));
+
+        _mm512_storeu_si512((void *) (next + j), _mm512_maskz_mov_epi8(alive, one));
+    }
+
+    evolve_padded_row(up + j, mid + j, down + j, next + j, ncols - j);
+}
+
+/**
+ * Read the extended control register XCR0, which states the register sets the OS saves on context switches.
+ */
+unsigned long long read_xcr0() {
+    unsigned int eax, edx;
+
+    __asm__ volatile ("xgetbv" : "=a" (eax), "=d" (edx) : "c" (0));
+
+    return ((unsigned long long) edx << 32) | eax;
+}
+#endif
+
+/**
+ * Detect the widest instruction set that both the running CPU and the OS support, via CPUID.
+ *
+ * The GoL_SIMD_MAX guard caps the detected level, e.g., -DGoL_SIMD_MAX=1 to force SSE4.2 kernels.
+ */
+int detect_simd_level() {
+    int level = SIMD_SCALAR;
+
+    #ifdef GoL_X86
+    unsigned int eax, ebx, ecx, edx;
+
+    if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx))
+        return SIMD_SCALAR;
+
+    if (ecx & bit_SSE4_2)
+        level = SIMD_SSE42;
+
+    // AVX registers must also be saved by the OS
+    if (!(ecx & bit_OSXSAVE))
+        return level;
+
+    unsigned long long xcr0 = read_xcr0();
+
+    if (!__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx))
+        return level;
+
+    if ((ebx & bit_AVX2) && (xcr0 & 0x06) == 0x06)          // XMM and YMM state
+        level = SIMD_AVX2;
+
+    if ((ebx & bit_AVX512F) && (ebx & bit_AVX512BW)
+            && (xcr0 & 0xE6) == 0xE6)                        // ... and opmask and ZMM state
+        level = SIMD_AVX512;
+    #endif
+
+    #ifdef GoL_SIMD_MAX
+    if (level > GoL_SIMD_MAX)
+        level = GoL_SIMD_MAX;
+    #endif
+
+    return level;
+}
+
+/**
+ * Pick the row kernel for the widest instruction set available on the running CPU.
+ *
+ * @return level    The instruction set in enum SimdLevels the kernel was picked for.
+ */
+int init_simd() {
+    int level = detect_simd_level();
+
+    switch (level) {
+        #ifdef GoL_X86
+        case SIMD_AVX512:
+            simd_kernel = evolve_row_avx512;
+            break;
+        case SIMD_AVX2:
+            simd_kernel = evolve_row_avx2;
+            break;
+        case SIMD_SSE42:
+            simd_kernel = evolve_row_sse42;
+            break;
+        #endif
+        default:
+            simd_kernel = evolve_padded_row;
+    }
+
+    return level;
+}
+
+/**
+ * Perform one evolutionary step of the board with the row kernel picked by init_simd().
+ */
+void evolve_simd(life_t *life) {
+    evolve_padded_with(life, simd_kernel);
+}
+
+#ifdef GoL_MPI
+/**
+ * Evolve the rows in [from, to) of a chunk with the row kernel picked by init_simd(), once its ghost cells are up to date.
+ */
+void evolve_chunk_simd(chunk_t *chunk, int from, int to) {
+    evolve_chunk_padded_with(chunk, from, to, simd_kernel);
+}
+#endif
+
+#endif
@@ -0,0 +1,378 @@
+#ifndef GoL_ENGINE_SPARSE_H
+#define GoL_ENGINE_SPARSE_H
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Custom includes
+#include "../globals.h"
+#include "../life/life.h"
+#include "simd.h"
+
+/**
+ * GoL's board as the set of its ALIVE cells, each identified by its index i * ncols + j.
+ *
+ * At every step, each ALIVE cell adds itself to its own count and twice to the counts of its 8 neighbours, in an open-addressing
+ * hash map from cell indices to counts. A cell is then ALIVE at the next step iff its count is 5, i.e., 2 neighbours and ALIVE,
+ * or 6 and 7, i.e., 3 neighbours. Only ALIVE cells and their neighbours are ever visited.
+ */
+typedef struct sparse {
+    int64_t *cells;      // Indices of the ALIVE cells
+    int64_t *next_cells; // Indices of the ALIVE cells at the next step
+    size_t ncells;       // Number of ALIVE cells
+    size_t cells_size;   // Capacity of either array of cells
+
+    int64_t *keys;       // Cell index of each slot of the hash map, or -1 if the slot is empty
+    uint8_t *counts;     // Count of each slot of the hash map
+    size_t *used;        // Slots in use at the current step
+    size_t nslots;       // Number of slots of the hash map, a power of 2
+    int log_nslots;      // log2 of the number of slots
+} sparse_t;
+
+/**
+ * Grow either array of cells of the set, so that it fits at least ncells ALIVE cells.
+ */
+void reserve_sparse_cells(sparse_t *sp, size_t ncells) {
+    if (ncells <= sp->cells_size)
+        return;
+
+    while (sp->cells_size < ncells)
+        sp->cells_size = sp->cells_size > 0 ? 2 * sp->cells_size : 1024;
+
+    sp->cells      = (int64_t *) realloc(sp->cells, sizeof(int64_t) * sp->cells_size);
+    sp->next_cells = (int64_t *) realloc(sp->next_cells, sizeof(int64_t) * sp->cells_size);
+
+    if (sp->cells == NULL || sp->next_cells == NULL) {
+        perror("[*] GoL's set of cells allocation failed!\n");
+        exit(EXIT_FAILURE);
+    }
+}
+
+/**
+ * Grow the hash map, so that it fits the neighbourhoods of all ALIVE cells with a load factor of 1/2 at most.
+ */
+void reserve_sparse_slots(sparse_t *sp) {
+    size_t nslots = sp->nslots > 0 ? sp->nslots : 1024;
+
+    while (nslots < 18 * sp->ncells)
+        nslots *= 2;
+
+    if (nslots == sp->nslots)
+        return;
+
+    sp->log_nslots = 0;
+
+    while (((size_t) 1 << sp->log_nslots) < nslots)
+        sp->log_nslots++;
+
+    free(sp->keys);
+    free(sp->counts);
+    free(sp->used);
+
+    sp->nslots = nslots;
+    sp->keys   = (int64_t *) malloc(sizeof(int64_t) * nslots);
+    sp->counts = (uint8_t *) calloc(nslots, sizeof(uint8_t));
+    sp->used   = (size_t *) malloc(sizeof(size_t) * nslots);
+
+    if (sp->keys == NULL || sp->counts == NULL
+            || sp->used == NULL) {
+        perror("[*] GoL's hash map of cells allocation failed!\n");
+        exit(EXIT_FAILURE);
+    }
+
+    memset(sp->keys, -1, sizeof(int64_t) * nslots);
+}
+
+/**
+ * Fill the set with the ALIVE cells of GoL's board.
+ */
+void sparse_from_grid(sparse_t *sp, life_t *life) {
+    int i, j;
+
+    sp->ncells = 0;
+
+    for (i = 0; i < life->nrows; i++)
+        for (j = 0; j < life->ncols; j++)
+            if (life->grid[i][j] == ALIVE) {
+                reserve_sparse_cells(sp, sp->ncells + 1);
+                sp->cells[sp->ncells++] = (int64_t) i * life->ncols + j;
+            }
+
+    reserve_sparse_slots(sp);
+}
+
+/**
+ * Write the set back to GoL's board, so that the dense engines and the display functions can use it.
+ */
+void sparse_to_grid(sparse_t *sp, life_t *life) {
+    int i;
+    size_t c;
+
+    for (i = 0; i < life->nrows; i++)
+        memset(life->grid[i], DEAD, life->ncols);
+
+    for (c = 0; c < sp->ncells; c++)
+        life->grid[sp->cells[c] / life->ncols][sp->cells[c] % life->ncols] = ALIVE;
+}
+
+/**
+ * Add a value to the count of a cell in the hash map, inserting the cell if it is not there yet.
+ *
+ * Within each run of nslots consecutive cell indices, cells map to consecutive slots, so that neighbour cells in a row
+ * share cache lines. Each run is then offset by a multiplicative hash of its number, so that cells nslots apart do not collide.
+ *
+ * @return nused    The number of slots in use, including the one of the cell.
+ */
+static inline size_t add_sparse_count(sparse_t *sp, int64_t cell,
+        uint8_t value, size_t nused) {
+    size_t slot = (size_t) ((uint64_t) cell
+            + ((uint64_t) cell >> sp->log_nslots) * 0x9E3779B97F4A7C15ULL) & (sp->nslots - 1);
+
+    // Linear probing
+    while (sp->keys[slot] != cell) {
+        if (sp->keys[slot] == -1) {
+            sp->keys[slot]  = cell;
+            sp->used[nused++] = slot;
+            break;
+        }
+
+        slot = (slot + 1) & (sp->nslots - 1);
+    }
+
+    sp->counts[slot] += value;
+
+    return nused;
+}
+
+/**
+ * Perform one evolutionary step of the set of ALIVE cells, following GoL rules on a toroidal board.
+ */
+void evolve_sparse_cells(sparse_t *sp, int nrows, int ncols) {
+    int di, dj;
+    size_t c, s;
+
+    size_t nused = 0;
+
+    reserve_sparse_slots(sp);
+
+    // 1. Count the neighbours of all ALIVE cells and of their neighbours
+    for (c = 0; c < sp->ncells; c++) {
+        int i = (int) (sp->cells[c] / ncols);
+        int j = (int) (sp->cells[c] % ncols);
+
+        for (di = -1; di <= 1; di++) {
+            int64_t row = (int64_t) ((i + di + nrows) % nrows) * ncols;
+
+            for (dj = -1; dj <= 1; dj++)
+                nused = add_sparse_count(sp, row + (j + dj + ncols) % ncols,
+                        (di == 0 && dj == 0) ? 1 : 2, nused);
+        }
+    }
+
+    // 2. Collect the ALIVE cells at the next step, and empty the slots in use
+    size_t ncells = 0;
+
+    reserve_sparse_cells(sp, nused);
+
+    for (s = 0; s < nused; s++) {
+        size_t slot = sp->used[s];
+
+        uint8_t count = sp->counts[slot];
+
+        if (count == 5 || count == 6 || count == 7)
+            sp->next_cells[ncells++] = sp->keys[slot];
+
+        sp->keys[slot]   = -1;
+        sp->counts[slot] = 0;
+    }
+
+    // 3. Replace the old set with the updated one
+    int64_t *temp  = sp->cells;
+
+    sp->cells      = sp->next_cells;
+    sp->next_cells = temp;
+    sp->ncells     = ncells;
+}
+
+void free_sparse(sparse_t *sp) {
+    free(sp->cells);
+    free(sp->next_cells);
+    free(sp->keys);
+    free(sp->counts);
+    free(sp->used);
+}
+
+void init_sparse(life_t *life) {
+    sparse_t *sp = (sparse_t *) calloc(1, sizeof(sparse_t));
+
+    if (sp == NULL) {
+        perror("[*] GoL's set of cells allocation failed!\n");
+        exit(EXIT_FAILURE);
+    }
+
+    sparse_from_grid(sp, life);
+
+    life->engine_state = sp;
+}
+
+/**
+ * Perform one evolutionary step of the board, only visiting its ALIVE cells and their neighbours.
+ */
+void evolve_sparse(life_t *life) {
+    evolve_sparse_cells((sparse_t *) life->engine_state,
+            life->nrows, life->ncols);
+}
+
+void sync_sparse(life_t *life) {
+    sparse_to_grid((sparse_t *) life->engine_state, life);
+}
+
+void cleanup_sparse(life_t *life) {
+    free_sparse((sparse_t *) life->engine_state);
+    free(life->engine_state);
+
+    life->engine_state = NULL;
+}
+
+/*
+ * The auto engine evolves the board with the sparse engine while its density is below DEFAULT_SPARSE_DENSITY, and with the simd one
+ * otherwise. The density is measured at startup, and then at every step by the sparse engine, which gets it for free, or every
+ * DEFAULT_DENSITY_PERIOD steps by the simd one. The sparse engine hands over only once the density doubles the threshold, so that
+ * a population that hovers around it does not switch back and forth.
+ */
+
+/**
+ * State of the auto engine: the set of ALIVE cells is only up to date while the sparse engine is in use.
+ */
+typedef struct autosel {
+    sparse_t sparse;          // Set of ALIVE cells
+    bool is_sparse;           // Whether the sparse engine is in use
+
+    int countdown;            // Number of steps left before the simd engine measures the density again
+    long long sparse_steps;   // Number of steps evolved by the sparse engine
+    long long dense_steps;    // Number of steps evolved by the simd engine
+    int nswitches;            // Number of switches between engines
+} autosel_t;
+
+/**
+ * Count the ALIVE cells of GoL's board.
+ */
+long long count_alive(life_t *life) {
+    int i, j;
+
+    long long n_alive = 0;
+
+    #ifdef _OPENMP
+    #pragma omp parallel for private(j) reduction(+:n_alive)
+    #endif
+    for (i = 0; i < life->nrows; i++)
+        for (j = 0; j < life->ncols; j++)
+            n_alive += life->grid[i][j];
+
+    return n_alive;
+}
+
+/**
+ * Evaluate whether GoL's board has less than max_alive ALIVE cells, stopping as soon as it has more.
+ */
+bool has_fewer_alive(life_t *life, double max_alive) {
+    int i, j;
+
+    long long n_alive = 0;
+
+    for (i = 0; i < life->nrows && n_alive < max_alive; i++)
+        for (j = 0; j < life->ncols; j++)
+            n_alive += life->grid[i][j];
+
+    return n_alive < max_alive;
+}
+
+void init_auto(life_t *life) {
+    autosel_t *as = (autosel_t *) calloc(1, sizeof(autosel_t));
+
+    if (as == NULL) {
+        perror("[*] GoL's engine selection allocation failed!\n");
+        exit(EXIT_FAILURE);
+    }
+
+    init_simd();
+
+    double density = (double) count_alive(life) / ((double) life->nrows * life->ncols);
+
+    as->is_sparse = density < DEFAULT_SPARSE_DENSITY;
+    as->countdown = DEFAULT_DENSITY_PERIOD;
+
+    if (as->is_sparse)
+        sparse_from_grid(&as->sparse, life);
+
+    printf("Evolving GoL's grid with the %s engine, at a density of %.5f\n\n",
+            ENGINE_NAMES[as->is_sparse ? ENGINE_SPARSE : ENGINE_SIMD], density);
+
+    life->engine_state = as;
+}
+
+/**
+ * Perform one evolutionary step of the board with either the sparse or the simd engine, switching engine if the density
+ * crossed its threshold.
+ */
+void evolve_auto(life_t *life) {
+    autosel_t *as = (autosel_t *) life->engine_state;
+
+    double ncells = (double) life->nrows * life->ncols;
+
+    if (as->is_sparse) {
+        evolve_sparse_cells(&as->sparse, life->nrows, life->ncols);
+        as->sparse_steps++;
+
+        if (as->sparse.ncells > 2 * DEFAULT_SPARSE_DENSITY * ncells) {
+            sparse_to_grid(&as->sparse, life);
+
+            as->is_sparse = false;
+            as->countdown = DEFAULT_DENSITY_PERIOD;
+            as->nswitches++;
+        }
+    } else {
+        evolve_simd(life);
+        as->dense_steps++;
+
+        if (--as->countdown == 0) {
+            as->countdown = DEFAULT_DENSITY_PERIOD;
+
+            if (has_fewer_alive(life, DEFAULT_SPARSE_DENSITY * ncells)) {
+                sparse_from_grid(&as->sparse, life);
+
+                as->is_sparse = true;
+                as->nswitches++;
+            }
+        }
+    }
+}
+
+void sync_auto(life_t *life) {
+    autosel_t *as = (autosel_t *) life->engine_state;
+
+    if (as->is_sparse)
+        sparse_to_grid(&as->sparse, life);
+}
+
+/**
+ * Print to console how many steps each engine evolved.
+ */
+void report_auto(life_t life) {
+    autosel_t *as = (autosel_t *) life.engine_state;
+
+    printf("Evolved %lld generations with the %s engine and %lld with the %s one - %d switches\n",
+            as->sparse_steps, ENGINE_NAMES[ENGINE_SPARSE],
+            as->dense_steps, ENGINE_NAMES[ENGINE_SIMD], as->nswitches);
+}
+
+void cleanup_auto(life_t *life) {
+    free_sparse(&((autosel_t *) life->engine_state)->sparse);
+    free(life->engine_state);
+
+    life->engine_state = NULL;
+}
+
+#endif
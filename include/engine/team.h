@@ -0,0 +1,262 @@
+#ifndef GoL_ENGINE_TEAM_H
+#define GoL_ENGINE_TEAM_H
+
+#ifdef _OPENMP
+#include <omp.h>
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+// Custom includes
+#include "../globals.h"
+#include "../life/checkpoint.h"
+#include "../life/life.h"
+#include "../life/snapshot.h"
+#include "../utils/frame.h"
+#include "padded.h"
+#include "simd.h"
+
+/*
+ * The persistent team runs GoL's whole evolution within a single parallel region, rather than forking and joining a team of threads
+ * at every generation. Each thread owns a static block of rows, and only waits for the two threads that own the rows right above and
+ * below its own ones, as no other thread ever reads or writes them, via a flag per thread that holds its last completed generation.
+ */
+
+/**
+ * Evaluate whether the evolution engine can be run by a persistent team of threads.
+ */
+bool team_supports(int engine) {
+    return engine == ENGINE_NAIVE
+            || engine == ENGINE_PADDED
+            || engine == ENGINE_SIMD;
+}
+
+/**
+ * Evolve one row of GoL's board, following GoL rules, with toroidal index arithmetic on the columns, just like evolve().
+ */
+static inline void evolve_wrapped_row(const bool *up, const bool *mid,
+        const bool *down, bool *next, int ncols) {
+    int y, j;
+
+    for (y = 0; y < ncols; y++) {
+        int alive_neighbs = 0;
+
+        for (j = y - 1; j <= y + 1; j++) {
+            int c = (j + ncols) % ncols;
+
+            alive_neighbs += (up[c] == ALIVE) + (down[c] == ALIVE)
+                    + (j != y && mid[c] == ALIVE);
+        }
+
+        next[y] = (alive_neighbs == 3
+                || (alive_neighbs == 2
+                        && mid[y] == ALIVE)) \
+                ? ALIVE : DEAD;
+    }
+}
+
+/**
+ * Wait until a thread has completed the given generation.
+ *
+ * @return wait_time    The time spent waiting, in ms.
+ */
+double wait_team_flag(int *flag, int generation) {
+    int spins = 0;
+    int done;
+
+    double start = omp_get_wtime();
+
+    for (;;) {
+        #pragma omp atomic read seq_cst
+        done = *flag;
+
+        if (done >= generation)
+            break;
+
+        if (++spins == DEFAULT_TEAM_SPINS) {
+            spins = 0;
+            sched_yield();
+        }
+    }
+
+    return (omp_get_wtime() - start) * 1000.;
+}
+
+/**
+ * Perform GoL evolution for a given amount of generations with a persistent team of threads, and print the per-generation timings
+ * of thread 0 and the compute and wait times across all threads.
+ *
+ * The rows above and below each block are read toroidally from the grid, and the ghost columns of each row are refreshed by its own
+ * thread as soon as the row is written, so that no thread ever has to wait for the whole board to be ready. At checkpoints, each
+ * thread packs its own rows, and the team only synchronizes to hand them to the background writer. Likewise, at dumps, each thread
+ * copies its own rows into the queue of snapshots. The final board is dumped by the caller.
+ *
+ * @return tot_gene_time    The total time devolved to GoL evolution, as seen by thread 0.
+ */
+double evolve_team(life_t *life, checkpoint_t *ckpt, snapshots_t *snaps) {
+    int nrows = life->nrows;
+    int ncols = life->ncols;
+
+    int timesteps = life->timesteps;
+    int first     = life->generation; // # of the generation the board starts from
+
+    // Every thread owns at least one row
+    int nthreads = omp_get_max_threads() < nrows \
+            ? omp_get_max_threads() : nrows;
+
+    // Flags are one cache line apart, so that polling one does not slow down the writes to the others
+    int stride = DEFAULT_ALIGNMENT / sizeof(int);
+
+    int *flags = (int *) malloc(sizeof(int) * stride * nthreads);
+    double *compute_times = (double *) malloc(sizeof(double) * nthreads);
+    double *wait_times    = (double *) malloc(sizeof(double) * nthreads);
+
+    if (flags == NULL
+            || compute_times == NULL
+            || wait_times == NULL) {
+        perror("[*] GoL's thread team allocation failed!\n");
+        exit(EXIT_FAILURE);
+    }
+
+    double tot_gene_time = 0.;
+
+    int slot; // Slot of the queue of snapshots the board is dumped to, shared by the team
+
+    row_kernel_t kernel = life->engine == ENGINE_NAIVE \
+            ? evolve_wrapped_row \
+            : life->engine == ENGINE_SIMD ? simd_kernel : evolve_padded_row;
+
+    // Ghost columns of the current grid, as those of the next one are refreshed row by row
+    wrap_frame_cols(life->grid, 0, nrows, ncols, 1);
+
+    #pragma omp parallel num_threads(nthreads)
+    {
+        int i, t;
+
+        int tid = omp_get_thread_num();
+
+        int *flag      = flags + tid * stride;
+        int *prev_flag = flags + ((tid - 1 + nthreads) % nthreads) * stride;
+        int *next_flag = flags + ((tid + 1) % nthreads) * stride;
+
+        int from = (int) ((long long) nrows * tid / nthreads);
+        int to   = (int) ((long long) nrows * (tid + 1) / nthreads);
+
+        bool **grid      = life->grid;
+        bool **next_grid = life->next_grid;
+
+        double compute_time = 0.;
+        double wait_time    = 0.;
+
+        #pragma omp atomic write seq_cst
+        *flag = first - 1;
+
+        #pragma omp barrier
+
+        for (t = first; t < timesteps; t++) {
+            double start = omp_get_wtime();
+
+            // 1. Wait until both neighbours have completed the previous generation, i.e., the rows above and below the block
+            // are up to date, and no longer read from the rows about to be overwritten
+            if (t > first) {
+                wait_time += wait_team_flag(prev_flag, t - 1);
+                wait_time += wait_team_flag(next_flag, t - 1);
+            }
+
+            double cstart = omp_get_wtime();
+
+            // 2. Evolve the block of rows, and refresh their ghost columns
+            for (i = from; i < to; i++) {
+                bool *next = next_grid[i];
+
+                kernel(grid[(i - 1 + nrows) % nrows], grid[i], grid[(i + 1) % nrows],
+                        next, ncols);
+
+                next[-1]    = next[ncols - 1];
+                next[ncols] = next[0];
+            }
+
+            compute_time += (omp_get_wtime() - cstart) * 1000.;
+
+            // 3. Publish the completed generation
+            #pragma omp atomic write seq_cst
+            *flag = t;
+
+            bool **temp = grid;
+
+            grid      = next_grid;
+            next_grid = temp;
+
+            if (tid == 0) {
+                double cur_gene_time = (omp_get_wtime() - start) * 1000.;
+
+                tot_gene_time += cur_gene_time;
+
+                printf("Generation #%d took %.5f ms\n", t, cur_gene_time);
+            }
+
+            // 4. Write a checkpoint in the background, every so many generations
+            if (is_checkpoint(ckpt, t + 1)) {
+                #pragma omp single
+                wait_checkpoint(ckpt);
+
+                pack_checkpoint(ckpt, grid, from, to);
+
+                #pragma omp barrier
+
+                #pragma omp single
+                start_checkpoint(ckpt, t + 1);
+            }
+
+            // 5. Dump the board to the queue of snapshots, every so many generations but the last one
+            if (t + 1 < timesteps && is_snapshot(snaps, t + 1)) {
+                #pragma omp single
+                slot = acquire_snapshot(snaps, false);
+
+                if (slot != -1) {
+                    copy_snapshot(snaps, slot, grid, from, to);
+
+                    #pragma omp barrier
+
+                    #pragma omp single
+                    commit_snapshot(snaps, slot, true);
+                }
+            }
+        }
+
+        compute_times[tid] = compute_time;
+        wait_times[tid]    = wait_time;
+    }
+
+    // All threads swapped their grids as many times as the generations
+    if ((timesteps - first) % 2 == 1)
+        swap_grids(&life->grid, &life->next_grid);
+
+    // Compute and wait times across threads
+    int tid;
+
+    double min_compute = compute_times[0], max_compute = compute_times[0], avg_compute = 0.;
+    double min_wait    = wait_times[0],    max_wait    = wait_times[0],    avg_wait    = 0.;
+
+    for (tid = 0; tid < nthreads; tid++) {
+        min_compute = compute_times[tid] < min_compute ? compute_times[tid] : min_compute;
+        max_compute = compute_times[tid] > max_compute ? compute_times[tid] : max_compute;
+        min_wait    = wait_times[tid] < min_wait ? wait_times[tid] : min_wait;
+        max_wait    = wait_times[tid] > max_wait ? wait_times[tid] : max_wait;
+
+        avg_compute += compute_times[tid] / nthreads;
+        avg_wait    += wait_times[tid] / nthreads;
+    }
+
+    printf("\nEvolved with a persistent team of %d threads - compute min/avg/max: %.5f/%.5f/%.5f ms, wait min/avg/max: %.5f/%.5f/%.5f ms\n",
+            nthreads, min_compute, avg_compute, max_compute, min_wait, avg_wait, max_wait);
+
+    free(flags);
+    free(compute_times);
+    free(wait_times);
+
+    return tot_gene_time;
+}
+#endif
+
+#endif
@@ -0,0 +1,205 @@
+#ifndef GoL_ENGINE_TEMPORAL_H
+#define GoL_ENGINE_TEMPORAL_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+// Custom includes
+#include "../globals.h"
+#include "../life/life.h"
+#include "../utils/frame.h"
+#include "simd.h"
+
+/**
+ * Local buffers of the temporal engine, two per thread, each holding a tile together with its halo.
+ */
+typedef struct temporal {
+    int nthreads;   // Number of threads with their own buffers
+    int stride;     // Number of cells per row of the buffers, rounded up to whole cache lines
+    bool **buffers; // Buffers of the t-th thread at 2t and 2t + 1
+} temporal_t;
+
+/**
+ * Copy len cells of a row of GoL's board, starting from column from, wrapping around the board's borders.
+ */
+void copy_wrapped_row(bool *dst, const bool *row,
+        int from, int len, int ncols) {
+    int j = ((from % ncols) + ncols) % ncols;
+
+    while (len > 0) {
+        int run = ncols - j < len ? ncols - j : len;
+
+        memcpy(dst, row + j, run);
+
+        dst += run;
+        len -= run;
+        j    = 0;
+    }
+}
+
+/**
+ * Advance one tile of GoL's board by k generations, within two local buffers, and write it to the next grid.
+ *
+ * The tile is loaded together with a halo k cells thick, wrapping around the board's borders. At the g-th generation, only the cells
+ * that are g cells or more away from the buffer's borders are evolved, as the others miss some neighbours: thus, the valid region
+ * shrinks by one cell per side and generation, i.e., a trapezoid in time, and after k generations it matches the tile.
+ *
+ * @param buf, next_buf    Local buffers of at least (tile_rows + 2k) x stride cells each.
+ */
+void evolve_temporal_tile(life_t *life, bool *buf, bool *next_buf, int stride,
+        int r0, int c0, int tile_rows, int tile_cols, int k) {
+    int i, g;
+
+    int nrows = life->nrows;
+    int ncols = life->ncols;
+
+    int height = tile_rows + 2*k;
+    int width  = tile_cols + 2*k;
+
+    // 1. Load the tile and its halo
+    for (i = 0; i < height; i++)
+        copy_wrapped_row(buf + (size_t) i * stride,
+                life->grid[((r0 - k + i) % nrows + nrows) % nrows],
+                c0 - k, width, ncols);
+
+    // 2. Evolve the shrinking valid region for k generations
+    for (g = 1; g <= k; g++) {
+        for (i = g; i < height - g; i++)
+            simd_kernel(buf + (size_t) (i - 1) * stride + g,
+                    buf + (size_t) i * stride + g,
+                    buf + (size_t) (i + 1) * stride + g,
+                    next_buf + (size_t) i * stride + g, width - 2*g);
+
+        bool *temp = buf;
+
+        buf      = next_buf;
+        next_buf = temp;
+    }
+
+    // 3. Store the tile
+    for (i = 0; i < tile_rows; i++)
+        memcpy(life->next_grid[r0 + i] + c0,
+                buf + (size_t) (k + i) * stride + k, tile_cols);
+}
+
+/**
+ * Allocate the local buffers of all threads once, so that they stay in cache from one time block to the next.
+ */
+void init_temporal(life_t *life) {
+    int b;
+
+    temporal_t *tp = (temporal_t *) malloc(sizeof(temporal_t));
+
+    if (tp == NULL) {
+        perror("[*] GoL's tile buffers allocation failed!\n");
+        exit(EXIT_FAILURE);
+    }
+
+    #ifdef _OPENMP
+    tp->nthreads = omp_get_max_threads();
+    #else
+    tp->nthreads = 1;
+    #endif
+
+    int height = DEFAULT_TEMPORAL_TILE_ROWS + 2*life->time_block;
+
+    tp->stride  = (int) align_up(DEFAULT_TEMPORAL_TILE_COLS + 2*life->time_block);
+    tp->buffers = (bool **) malloc(sizeof(bool *) * 2 * tp->nthreads);
+
+    if (tp->buffers == NULL) {
+        perror("[*] GoL's tile buffers allocation failed!\n");
+        exit(EXIT_FAILURE);
+    }
+
+    for (b = 0; b < 2 * tp->nthreads; b++) {
+        tp->buffers[b] = (bool *) malloc((size_t) height * tp->stride);
+
+        if (tp->buffers[b] == NULL) {
+            perror("[*] GoL's tile buffers allocation failed!\n");
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    life->engine_state = tp;
+
+    printf("Evolving GoL's grid by %d generations per %dx%d tile with %s kernels\n\n",
+            life->time_block, DEFAULT_TEMPORAL_TILE_ROWS, DEFAULT_TEMPORAL_TILE_COLS, SIMD_NAMES[init_simd()]);
+}
+
+/**
+ * Perform up to k evolutionary steps of the board at once with temporal blocking, where k is the time block given on
+ * the command line.
+ *
+ * The board is split into cache-sized tiles, and each tile is advanced by all k generations before moving on to the next one, thus
+ * the whole board is read from and written to memory once every k generations rather than at every one. The price is the redundant
+ * evolution of the overlapping halos, about k / DEFAULT_TEMPORAL_TILE_ROWS of the cells per generation.
+ *
+ * @return steps    The number of generations the board has been advanced by.
+ */
+int evolve_temporal(life_t *life, int max_steps) {
+    int t;
+
+    int nrows = life->nrows;
+    int ncols = life->ncols;
+
+    int k = life->time_block < max_steps ? life->time_block : max_steps;
+
+    int tile_rows = DEFAULT_TEMPORAL_TILE_ROWS;
+    int tile_cols = DEFAULT_TEMPORAL_TILE_COLS;
+
+    int ntile_rows = (nrows + tile_rows - 1) / tile_rows;
+    int ntile_cols = (ncols + tile_cols - 1) / tile_cols;
+
+    temporal_t *tp = (temporal_t *) life->engine_state;
+
+    #ifdef _OPENMP
+    #pragma omp parallel num_threads(tp->nthreads)
+    #endif
+    {
+        #ifdef _OPENMP
+        int tid = omp_get_thread_num();
+        #else
+        int tid = 0;
+        #endif
+
+        bool *buf      = tp->buffers[2*tid];
+        bool *next_buf = tp->buffers[2*tid + 1];
+
+        #ifdef _OPENMP
+        #pragma omp for schedule(static)
+        #endif
+        for (t = 0; t < ntile_rows * ntile_cols; t++) {
+            int r0 = (t / ntile_cols) * tile_rows;
+            int c0 = (t % ntile_cols) * tile_cols;
+
+            evolve_temporal_tile(life, buf, next_buf, tp->stride, r0, c0,
+                    r0 + tile_rows < nrows ? tile_rows : nrows - r0,
+                    c0 + tile_cols < ncols ? tile_cols : ncols - c0, k);
+        }
+    }
+
+    swap_grids(&life->grid, &life->next_grid);
+
+    return k;
+}
+
+void cleanup_temporal(life_t *life) {
+    int b;
+
+    temporal_t *tp = (temporal_t *) life->engine_state;
+
+    for (b = 0; b < 2 * tp->nthreads; b++)
+        free(tp->buffers[b]);
+
+    free(tp->buffers);
+    free(tp);
+
+    life->engine_state = NULL;
+}
+
+#endif
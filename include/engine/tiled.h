@@ -0,0 +1,238 @@
+#ifndef GoL_ENGINE_TILED_H
+#define GoL_ENGINE_TILED_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Custom includes
+#include "../globals.h"
+#include "../life/life.h"
+#include "../utils/frame.h"
+#include "padded.h"
+#include "simd.h"
+
+/**
+ * GoL's board split into square tiles, with a flag per tile that tracks whether any of its cells changed at the last step
+ * with respect to two steps before. Comparing with two steps before treats blinkers as settled, just like still lifes.
+ */
+typedef struct tiled {
+    int tile_size;       // Number of rows/columns per tile
+    int ntile_rows;      // Number of tiles along the rows
+    int ntile_cols;      // Number of tiles along the columns
+    int warmup;          // Number of steps left before flags can be trusted
+
+    bool *changed;       // Whether each tile changed at the current step
+    bool *next_changed;  // Whether each tile changed at the next step
+
+    long long evaluated; // Number of tiles evaluated so far
+    long long skipped;   // Number of tiles skipped so far
+} tiled_t;
+
+/**
+ * Initialize the tiles of GoL's board. Every tile is evaluated at the first two steps, as there is no previous step to compare with yet.
+ */
+void init_tiled(life_t *life) {
+    int t;
+
+    tiled_t *tiled = (tiled_t *) malloc(sizeof(tiled_t));
+
+    if (tiled == NULL) {
+        perror("[*] GoL's tiles allocation failed!\n");
+        exit(EXIT_FAILURE);
+    }
+
+    tiled->tile_size  = DEFAULT_TILE_SIZE;
+    tiled->ntile_rows = (life->nrows + tiled->tile_size - 1) / tiled->tile_size;
+    tiled->ntile_cols = (life->ncols + tiled->tile_size - 1) / tiled->tile_size;
+
+    int ntiles = tiled->ntile_rows * tiled->ntile_cols;
+
+    tiled->changed      = (bool *) malloc(sizeof(bool) * ntiles);
+    tiled->next_changed = (bool *) malloc(sizeof(bool) * ntiles);
+
+    if (tiled->changed == NULL
+            || tiled->next_changed == NULL) {
+        perror("[*] GoL's tiles allocation failed!\n");
+        exit(EXIT_FAILURE);
+    }
+
+    for (t = 0; t < ntiles; t++)
+        tiled->changed[t] = true;
+
+    // Tiles are evolved with the widest row kernel available
+    init_simd();
+
+    tiled->warmup    = 2;
+    tiled->evaluated = 0;
+    tiled->skipped   = 0;
+
+    life->engine_state = tiled;
+}
+
+/**
+ * Evaluate whether a tile has to be evolved, that is, whether either itself or any of its 8 neighbour tiles changed at the last step.
+ * Tiles wrap around the board's borders, as the board is toroidal.
+ */
+bool is_tile_active(tiled_t *tiled, int tr, int tc) {
+    int i, j;
+
+    int ntile_rows = tiled->ntile_rows;
+    int ntile_cols = tiled->ntile_cols;
+
+    for (i = tr - 1; i <= tr + 1; i++)
+        for (j = tc - 1; j <= tc + 1; j++)
+            if (tiled->changed[((i + ntile_rows) % ntile_rows) * ntile_cols
+                    + (j + ntile_cols) % ntile_cols])
+                return true;
+
+    return false;
+}
+
+/**
+ * Copy a row segment of a tile to the next grid.
+ *
+ * @return changed    Whether the segment differs from the one that was in the next grid, i.e., two steps before.
+ */
+static inline bool update_tile_row(bool *next, const bool *row, int ncols) {
+    if (memcmp(next, row, ncols) == 0)
+        return false;
+
+    memcpy(next, row, ncols);
+    return true;
+}
+
+/**
+ * Perform one evolutionary step of the board, tile by tile, skipping all those tiles which cannot change.
+ *
+ * If the neighbourhood of a tile at the current step is the same as two steps before, the tile at the next step will be the same as
+ * at the previous step. The next grid still holds the previous step, thus the tile can be skipped altogether, and not even copied.
+ *
+ * Tiles are evolved one row of tiles at a time, so that each run of consecutive active tiles takes a single call of the row kernel.
+ */
+void evolve_tiled(life_t *life) {
+    int tr;
+
+    int ncols = life->ncols;
+    int nrows = life->nrows;
+
+    tiled_t *tiled = (tiled_t *) life->engine_state;
+
+    int tile_size  = tiled->tile_size;
+    int ntile_rows = tiled->ntile_rows;
+    int ntile_cols = tiled->ntile_cols;
+
+    long long skipped = 0;
+
+    // 1. Refresh the ghost frame
+    wrap_frame(life->grid, nrows, ncols, 1);
+
+    // 2. Evolve all active tiles, whose workload varies a lot across rows of tiles
+    #ifdef _OPENMP
+    #pragma omp parallel reduction(+:skipped)
+    #endif
+    {
+        // Next state of the row being evolved, and active flags of the row of tiles
+        bool *row    = (bool *) malloc(sizeof(bool) * ncols);
+        bool *active = (bool *) malloc(sizeof(bool) * ntile_cols);
+
+        if (row == NULL
+                || active == NULL) {
+            perror("[*] GoL's tiles allocation failed!\n");
+            exit(EXIT_FAILURE);
+        }
+
+        #ifdef _OPENMP
+        #pragma omp for schedule(dynamic)
+        #endif
+        for (tr = 0; tr < ntile_rows; tr++) {
+            int i, tc;
+
+            bool *next_changed = tiled->next_changed + tr * ntile_cols;
+
+            for (tc = 0; tc < ntile_cols; tc++) {
+                active[tc] = tiled->warmup > 0
+                        || is_tile_active(tiled, tr, tc);
+
+                next_changed[tc] = false;
+                skipped += !active[tc];
+            }
+
+            int r0 = tr * tile_size;
+            int r1 = r0 + tile_size < nrows ? r0 + tile_size : nrows;
+
+            for (i = r0; i < r1; i++) {
+                tc = 0;
+
+                while (tc < ntile_cols) {
+                    if (!active[tc]) {
+                        tc++;
+                        continue;
+                    }
+
+                    // Run of consecutive active tiles, [tc, end)
+                    int end = tc;
+
+                    while (end < ntile_cols && active[end])
+                        end++;
+
+                    int c0 = tc * tile_size;
+                    int c1 = end * tile_size < ncols ? end * tile_size : ncols;
+
+                    simd_kernel(life->grid[i - 1] + c0, life->grid[i] + c0, life->grid[i + 1] + c0,
+                            row + c0, c1 - c0);
+
+                    for (; tc < end; tc++) {
+                        int from = tc * tile_size;
+                        int to   = from + tile_size < ncols ? from + tile_size : ncols;
+
+                        next_changed[tc] |= update_tile_row(life->next_grid[i] + from,
+                                row + from, to - from);
+                    }
+                }
+            }
+        }
+
+        free(row);
+        free(active);
+    }
+
+    tiled->evaluated += (long long) ntile_rows * ntile_cols - skipped;
+    tiled->skipped   += skipped;
+
+    if (tiled->warmup > 0)
+        tiled->warmup--;
+
+    // 3. Replace the old grid and flags with the updated ones
+    swap_grids(&life->grid, &life->next_grid);
+
+    bool *temp = tiled->changed;
+
+    tiled->changed      = tiled->next_changed;
+    tiled->next_changed = temp;
+}
+
+/**
+ * Print to console the fraction of tiles that have been skipped across all steps.
+ */
+void report_tiled(life_t life) {
+    tiled_t *tiled = (tiled_t *) life.engine_state;
+
+    long long total = tiled->evaluated + tiled->skipped;
+
+    printf("Skipped %lld out of %lld tiles of %dx%d cells - %.2f%%\n",
+            tiled->skipped, total, tiled->tile_size, tiled->tile_size,
+            total > 0 ? 100. * tiled->skipped / total : 0.);
+}
+
+void cleanup_tiled(life_t *life) {
+    tiled_t *tiled = (tiled_t *) life->engine_state;
+
+    free(tiled->changed);
+    free(tiled->next_changed);
+    free(tiled);
+
+    life->engine_state = NULL;
+}
+
+#endif
@@ -33,9 +33,37 @@ const int DEFAULT_MAX_SIZE = DEFAULT_SIZE_ROWS * DEFAULT_SIZE_COLS;
 
 const unsigned int DEFAULT_SEED = 1;
 
+// Alignment in bytes of the rows of GoL's board in memory, i.e., a cache line
+const int DEFAULT_ALIGNMENT = 64;
+
+// Size in bytes of the buffer GoL's board is formatted into before it goes to the output file
+const int DEFAULT_WRITE_BUFFER = 1 << 23;
+
+// GoL's rule, B3/S23, as the bitmasks of the numbers of ALIVE neighbours for which a DEAD cell is born and an ALIVE cell survives
+const unsigned int RULE_BIRTH    = 1 << 3;
+const unsigned int RULE_SURVIVAL = 1 << 2 | 1 << 3;
+
 #ifdef _OPENMP
 const int DEFAULT_NUM_THREADS = 4;
 const int DEFAULT_MAX_THREADS = 256; // 4 threads x 64 cores per processor
+
+// How threads are organized across generations
+enum Teams {
+    TEAM_FORK,       // A team is forked and joined at every generation
+    TEAM_PERSISTENT, // A single team evolves all generations, synchronizing neighbour threads only
+    NUM_TEAMS
+};
+
+// Command line names of the teams, in the same order as enum Teams
+const char *TEAM_NAMES[NUM_TEAMS] = {
+    "fork",
+    "persistent"
+};
+
+const int DEFAULT_TEAM = TEAM_PERSISTENT;
+
+// Number of polls of a neighbour's flag before yielding the core, in case threads outnumber cores
+const int DEFAULT_TEAM_SPINS = 1024;
 #endif
 
 #ifdef GoL_CUDA
@@ -45,12 +73,198 @@ const int DEFAULT_BLOCK_SIZE     = 128;  // Number of threads per block
 const int DEFAULT_MAX_BLOCK_SIZE = 1024;
 #endif
 
+#ifndef GoL_CUDA
+// Evolution engines that can be selected at runtime
+enum Engines {
+    ENGINE_NAIVE,    // One bool per cell, 3x3 neighbourhood scan with toroidal wrap
+    ENGINE_BITPACK,  // 64 cells per word, bitwise-parallel neighbour counting
+    ENGINE_PADDED,   // One bool per cell, ghost frame refreshed once per generation
+    ENGINE_SIMD,     // As ENGINE_PADDED, with SSE4.2/AVX2/AVX-512 kernels picked at startup
+    ENGINE_LUT,      // One bool per cell, 4x4 neighbourhoods looked up in a table to evolve 2x2 cells at once
+    ENGINE_COLSUM,   // One bool per cell, rolling vertical sums of 3 cells added horizontally
+    ENGINE_TILED,    // As ENGINE_SIMD, skipping the tiles whose neighbourhood is the same as two steps before
+    ENGINE_HASHLIFE, // Hash-consed quadtree, advancing the board by powers of 2 generations at once
+    ENGINE_SPARSE,   // Set of ALIVE cells, only visiting them and their neighbours
+    ENGINE_AUTO,     // ENGINE_SPARSE or ENGINE_SIMD, depending on the density of ALIVE cells
+    ENGINE_TEMPORAL, // As ENGINE_SIMD, advancing cache-sized tiles by several generations at once
+    NUM_ENGINES
+};
+
+// Command line names of the engines, in the same order as enum Engines
+const char *ENGINE_NAMES[NUM_ENGINES] = {
+    "naive",
+    "bitpack",
+    "padded",
+    "simd",
+    "lut",
+    "colsum",
+    "tiled",
+    "hashlife",
+    "sparse",
+    "auto",
+    "temporal"
+};
+
+const int DEFAULT_ENGINE = ENGINE_NAIVE;
+
+// Number of rows/columns of the square tiles whose activity is tracked by ENGINE_TILED
+const int DEFAULT_TILE_SIZE = 64;
+
+// Memory cap of the nodes of ENGINE_HASHLIFE, in MB, past which garbage collection takes place
+const int DEFAULT_HASHLIFE_MEMORY = 1024;
+
+// Density of ALIVE cells below which ENGINE_AUTO picks ENGINE_SPARSE, and how often ENGINE_SIMD measures it, in generations
+const double DEFAULT_SPARSE_DENSITY = 0.002;
+const int DEFAULT_DENSITY_PERIOD    = 32;
+
+// Number of generations ENGINE_TEMPORAL advances each tile by, and number of rows and columns of its tiles.
+// Tiles are wide, so that each of their rows spans whole memory pages.
+const int DEFAULT_TIME_BLOCK         = 4;
+const int DEFAULT_TEMPORAL_TILE_ROWS = 64;
+const int DEFAULT_TEMPORAL_TILE_COLS = 4096;
+
+// Number of generations between checkpoints of GoL's board, or 0 to never write them, and extension of the checkpoint file,
+// which is named after the output file
+const int DEFAULT_CHECKPOINT_PERIOD = 0;
+const char *DEFAULT_CHECKPOINT_EXT  = ".ckpt";
+
+// Number of generations between dumps of large boards to the output file, or 0 to only dump the initial and final ones, and
+// number of dumps that can be queued for the background writer at once
+const int DEFAULT_DUMP_PERIOD = 0;
+const int DEFAULT_QUEUE_DEPTH = 2;
+
+// What the generation loop does when the queue of dumps is full
+enum Backpressures {
+    BACKPRESSURE_WAIT, // Wait until the background writer frees a slot
+    BACKPRESSURE_DROP, // Skip the dump, but the initial and final ones
+    NUM_BACKPRESSURES
+};
+
+// Names of the backpressure policies, in the same order as enum Backpressures
+const char *BACKPRESSURE_NAMES[NUM_BACKPRESSURES] = {
+    "wait",
+    "drop"
+};
+
+const int DEFAULT_BACKPRESSURE = BACKPRESSURE_WAIT;
+
+// Formats of pattern files, which GoL's board can be seeded from and exported to
+enum Patterns {
+    PATTERN_NONE,    // Not a pattern, e.g., a board in FM or binary format
+    PATTERN_RLE,     // Run length encoded, as Golly's
+    PATTERN_LIFE106, // Life 1.06, i.e., the coordinates of one ALIVE cell per line
+    NUM_PATTERNS
+};
+
+// Names of the pattern formats, in the same order as enum Patterns
+const char *PATTERN_NAMES[NUM_PATTERNS] = {
+    "none",
+    "rle",
+    "life106"
+};
+
+// Maximum number of characters per line of RLE files
+const int RLE_LINE_LENGTH = 70;
+#endif
+
 #ifdef GoL_MPI
-// Message passing tags
+// Message passing tags. Ghost cells are tagged after the border of the sender they come from, and the
+// border at (di, dj) from the centre of a block, with di, dj in {-1, 0, 1}, has tag (di + 1) * 3 + dj + 1.
 enum Tags {
-    TOP,    // Send/receive data to/from the top MPI neighbour process
-    BOTTOM, // Send/receive data to/from the bottom MPI neighbour process
-    PRINT   // Send/receive data to print it to file/console
+    TOP_LEFT,     // Send/receive data to/from the top-left MPI neighbour process
+    TOP,          // Send/receive data to/from the top MPI neighbour process
+    TOP_RIGHT,    // Send/receive data to/from the top-right MPI neighbour process
+    LEFT,         // Send/receive data to/from the left MPI neighbour process
+    CENTRE,       // Unused, as a process is no neighbour of its own
+    RIGHT,        // Send/receive data to/from the right MPI neighbour process
+    BOTTOM_LEFT,  // Send/receive data to/from the bottom-left MPI neighbour process
+    BOTTOM,       // Send/receive data to/from the bottom MPI neighbour process
+    BOTTOM_RIGHT, // Send/receive data to/from the bottom-right MPI neighbour process
+    PRINT,        // Send/receive data to print it to file/console
+    PROBE,        // Send/receive data to measure the latency and bandwidth of the network
+    REBALANCE     // Send/receive the rows that move from one MPI process to another
+};
+
+// Number of ghost rows on either side of a chunk, or HALO_AUTO to pick it from a probe of the network and of the evolution engine
+const int DEFAULT_HALO_DEPTH = 1;
+const int HALO_AUTO          = 0;
+
+// Number of repetitions of each measure of the probe
+const int DEFAULT_PROBE_REPS = 50;
+
+// How MPI processes write GoL's board to file
+enum Outputs {
+    OUTPUT_GATHER,     // Rank 0 gathers the board one band at a time and writes it on its own
+    OUTPUT_COLLECTIVE, // Every process writes its own block at its offset within the file, via collective MPI-IO
+    NUM_OUTPUTS
+};
+
+// Command line names of the outputs, in the same order as enum Outputs
+const char *OUTPUT_NAMES[NUM_OUTPUTS] = {
+    "gather",
+    "collective"
+};
+
+const int DEFAULT_OUTPUT = OUTPUT_COLLECTIVE;
+
+// How MPI processes exchange ghost rows with their neighbours
+enum Exchanges {
+    EXCHANGE_MESSAGE, // Via MPI messages, whether neighbours are on the same node or not
+    EXCHANGE_SHARED,  // Via a shared memory window with neighbours on the same node, and MPI messages otherwise
+    NUM_EXCHANGES
+};
+
+// Command line names of the exchanges, in the same order as enum Exchanges
+const char *EXCHANGE_NAMES[NUM_EXCHANGES] = {
+    "message",
+    "shared"
+};
+
+const int DEFAULT_EXCHANGE = EXCHANGE_MESSAGE;
+
+// Counters at the start of the shared memory segment of an MPI process, with EXCHANGE_SHARED
+enum SharedFlags {
+    SHARED_READY,    // # of blocks of generations the process has completed
+    SHARED_CONSUMED, // # of blocks of generations for which the process has copied its neighbours' borders
+    NUM_SHARED_FLAGS
+};
+
+// How rows go on the wire in ghost row and gather messages among MPI processes
+enum Wires {
+    WIRE_BYTES,  // One byte per cell
+    WIRE_PACKED, // One bit per cell, skipping the rows with no ALIVE cells
+    NUM_WIRES
+};
+
+// Command line names of the wire formats, in the same order as enum Wires
+const char *WIRE_NAMES[NUM_WIRES] = {
+    "bytes",
+    "packed"
+};
+
+const int DEFAULT_WIRE = WIRE_PACKED;
+
+// Number of polls of a neighbour's counter before yielding the core, in case processes outnumber cores
+const int DEFAULT_SHARED_SPINS = 1024;
+
+// Number of generations between checks of the load balance of MPI processes, or 0 to never check it, and load imbalance
+// of the compute phase, as a percentage, past which rows are moved from the slower processes to the faster ones
+const int DEFAULT_REBALANCE_PERIOD       = 0;
+const double DEFAULT_REBALANCE_THRESHOLD = 10.;
+
+// Phases of GoL evolution timed by each MPI process
+enum Phases {
+    PHASE_COMPUTE, // Evolving the chunk, ghost cells included
+    PHASE_COMM,    // Posting the exchange of the ghost cells
+    PHASE_WAIT,    // Waiting for the ghost cells to arrive
+    NUM_PHASES
+};
+
+// Log file names of the phases, in the same order as enum Phases
+const char *PHASE_NAMES[NUM_PHASES] = {
+    "compute",
+    "comm",
+    "wait"
 };
 #endif
 
@@ -0,0 +1,188 @@
+#ifndef GoL_LIFE_CHECKPOINT_H
+#define GoL_LIFE_CHECKPOINT_H
+
+#include <pthread.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Custom includes
+#include "life.h"
+#include "../utils/board.h"
+#include "../utils/pack.h"
+
+/**
+ * A checkpoint of GoL's board, i.e., a binary board written every so many generations, from which the evolution can be restarted.
+ *
+ * The board is packed at the checkpoint, which is all the generation loop waits for, and then written by a background thread to
+ * a temporary file, which replaces the previous checkpoint once complete. Thus, a run that dies while writing still leaves the
+ * previous checkpoint behind. The next checkpoint waits for the previous one to be written, as they share the packed rows.
+ */
+typedef struct checkpoint {
+    int period;            // Number of generations between checkpoints, or 0 to never write them
+    char *path;            // Checkpoint file, i.e., the output file followed by DEFAULT_CHECKPOINT_EXT
+    char *temp_path;       // File the checkpoint is written to, before replacing the previous one
+
+    board_header_t header; // Header of the checkpoint being written
+    size_t row_words;      // Number of words per packed row, padding included
+    uint64_t *rows;        // Packed rows of the checkpoint being written
+
+    pthread_t writer;      // Background thread writing the checkpoint
+    bool pending;          // Whether the writer has yet to be joined
+} checkpoint_t;
+
+/**
+ * Name the checkpoint file after the output file, or the temporary file it is written to.
+ *
+ * @return path    The name, to be freed by the caller.
+ */
+char* checkpoint_path(const char *outfile, bool temp) {
+    char *path = (char *) malloc(strlen(outfile) + strlen(DEFAULT_CHECKPOINT_EXT) + 5);
+
+    if (path == NULL) {
+        perror("[*] Failed to allocate the checkpoint.");
+        exit(EXIT_FAILURE);
+    }
+
+    sprintf(path, "%s%s%s", outfile, DEFAULT_CHECKPOINT_EXT, temp ? ".tmp" : "");
+
+    return path;
+}
+
+/**
+ * Initialize the checkpoints of GoL's board, if requested, once its dimensions are known.
+ */
+void init_checkpoint(checkpoint_t *ckpt, life_t life) {
+    ckpt->period  = life.checkpoint;
+    ckpt->pending = false;
+    ckpt->rows    = NULL;
+
+    if (ckpt->period == 0)
+        return;
+
+    ckpt->path      = checkpoint_path(life.outfile, false);
+    ckpt->temp_path = checkpoint_path(life.outfile, true);
+
+    ckpt->row_words = board_row_words(life.ncols);
+    ckpt->rows      = (uint64_t *) calloc((size_t) life.nrows * ckpt->row_words, sizeof(uint64_t));
+
+    if (ckpt->rows == NULL) {
+        perror("[*] Failed to allocate the checkpoint.");
+        exit(EXIT_FAILURE);
+    }
+
+    init_board_header(&ckpt->header, life.nrows, life.ncols, 0, life.seed);
+}
+
+/**
+ * Evaluate whether a checkpoint is due once the given generation is complete.
+ */
+bool is_checkpoint(checkpoint_t *ckpt, int generation) {
+    return ckpt->period > 0 && generation % ckpt->period == 0;
+}
+
+/**
+ * Cap the number of generations evolved at once, so that they do not skip the next checkpoint.
+ */
+int checkpoint_steps(checkpoint_t *ckpt, int generation, int max_steps) {
+    if (ckpt->period == 0)
+        return max_steps;
+
+    int left = ckpt->period - generation % ckpt->period;
+
+    return left < max_steps ? left : max_steps;
+}
+
+/**
+ * Wait until the previous checkpoint, if any, has been written.
+ */
+void wait_checkpoint(checkpoint_t *ckpt) {
+    if (ckpt->pending) {
+        pthread_join(ckpt->writer, NULL);
+        ckpt->pending = false;
+    }
+}
+
+/**
+ * Pack the rows in [from, to) of GoL's board into the checkpoint, once the previous one has been written.
+ */
+void pack_checkpoint(checkpoint_t *ckpt, bool **grid, int from, int to) {
+    int i;
+
+    for (i = from; i < to; i++)
+        pack_row(grid[i], ckpt->header.ncols, ckpt->rows + ckpt->row_words * i);
+}
+
+/**
+ * Write the checkpoint to its temporary file, and replace the previous one with it. It runs on the background thread.
+ */
+void* write_checkpoint(void *arg) {
+    checkpoint_t *ckpt = (checkpoint_t *) arg;
+
+    FILE *ckpt_ptr = fopen(ckpt->temp_path, "wb");
+
+    if (ckpt_ptr == NULL) {
+        perror("[*] Failed to open the checkpoint file.");
+        exit(EXIT_FAILURE);
+    }
+
+    size_t nwords = (size_t) ckpt->header.nrows * ckpt->row_words;
+
+    if (fwrite(&ckpt->header, sizeof(board_header_t), 1, ckpt_ptr) != 1
+            || fwrite(ckpt->rows, sizeof(uint64_t), nwords, ckpt_ptr) != nwords
+            || fclose(ckpt_ptr) != 0
+            || rename(ckpt->temp_path, ckpt->path) != 0) {
+        perror("[*] Failed to write the checkpoint file.");
+        exit(EXIT_FAILURE);
+    }
+
+    return NULL;
+}
+
+/**
+ * Start writing the packed board as the checkpoint of the given generation, in the background.
+ */
+void start_checkpoint(checkpoint_t *ckpt, int generation) {
+    ckpt->header.generation = generation;
+
+    if (pthread_create(&ckpt->writer, NULL, write_checkpoint, ckpt) != 0) {
+        perror("[*] Failed to start writing the checkpoint.");
+        exit(EXIT_FAILURE);
+    }
+
+    ckpt->pending = true;
+}
+
+/**
+ * Write the checkpoint of GoL's board at the given generation, in the background, once the previous one has been written.
+ */
+void save_checkpoint(checkpoint_t *ckpt, life_t *life, int generation) {
+    int i;
+
+    wait_checkpoint(ckpt);
+
+    #ifdef _OPENMP
+    #pragma omp parallel for
+    #endif
+    for (i = 0; i < life->nrows; i++)
+        pack_checkpoint(ckpt, life->grid, i, i + 1);
+
+    start_checkpoint(ckpt, generation);
+}
+
+/**
+ * Wait until the last checkpoint has been written, and free its memory.
+ */
+void free_checkpoint(checkpoint_t *ckpt) {
+    wait_checkpoint(ckpt);
+
+    if (ckpt->period == 0)
+        return;
+
+    free(ckpt->path);
+    free(ckpt->temp_path);
+    free(ckpt->rows);
+}
+
+#endif
@@ -1,6 +1,7 @@
 #ifndef GoL_LIFE_INIT_H
 #define GoL_LIFE_INIT_H
 
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <sys/types.h>
@@ -9,14 +10,84 @@
 #include "life.h"
 #include "../utils/func.h"
 
+#ifndef GoL_CUDA
+#include "checkpoint.h"
+#include "pattern.h"
+#include "snapshot.h"
+#include "../utils/board.h"
+#include "../utils/frame.h"
+#include "../utils/pack.h"
+#endif
+
+#ifndef GoL_CUDA
 /**
- * Update the GoL board's dimensions from file, if it exists and it has a valid format.
+ * Update the GoL board's dimensions from the header of a binary board.
+ *
+ * @return header    The header of the binary board.
+ */
+board_header_t set_grid_dimens_from_board(life_t *life, const char *path) {
+    FILE *board_ptr;
+
+    board_header_t header;
+
+    if ((board_ptr = fopen(path, "rb")) == NULL) {
+        perror("[*] Failed to open the binary GoL board.");
+        exit(EXIT_FAILURE);
+    }
+
+    if (fread(&header, sizeof(board_header_t), 1, board_ptr) != 1) {
+        fprintf(stderr, "[*] The file is not a binary GoL board!\n");
+        exit(EXIT_FAILURE);
+    }
+
+    fclose(board_ptr);
+
+    if (!check_board_header(&header))
+        exit(EXIT_FAILURE);
+
+    if (header.nrows > INT32_MAX || header.ncols > INT32_MAX || header.generation > INT32_MAX) {
+        fprintf(stderr, "[*] The binary GoL board is larger than supported!\n");
+        exit(EXIT_FAILURE);
+    }
+
+    life->nrows = (int) header.nrows;
+    life->ncols = (int) header.ncols;
+    life->board = (char *) path;
+
+    return header;
+}
+#endif
+
+/**
+ * Update the GoL board's dimensions from file, if it exists and it has a valid format, or from the checkpoint to restart from,
+ * which takes precedence, along with its generation and seed. Binary boards, either a checkpoint or a binary input file, are
+ * loaded later on via init_from_board(). Input patterns, in RLE or Life 1.06 format, keep the dimensions given on the command line,
+ * and are placed on the board later on via init_from_pattern().
  * 
- * @return file_ptr    The pointer to the open input file, NULL otherwise. 
+ * @return file_ptr    The pointer to the open input file, if in FM format, NULL otherwise. 
  */
 FILE* set_grid_dimens_from_file(life_t *life) {
     FILE *file_ptr;
 
+    #ifndef GoL_CUDA
+    if (life->restart != NULL) {
+        board_header_t header = set_grid_dimens_from_board(life, life->restart);
+
+        life->generation = (int) header.generation;
+        life->seed       = header.seed;
+
+        return NULL;
+    }
+
+    if (life->infile != NULL && is_board(life->infile)) {
+        set_grid_dimens_from_board(life, life->infile);
+        return NULL;
+    }
+
+    if (life->infile != NULL && (life->pattern = sniff_pattern(life->infile)) != PATTERN_NONE)
+        return NULL;
+    #endif
+
     if (life->infile != NULL) {
         if ((file_ptr = fopen(life->infile, "r")) == NULL) {
             perror("[*] Failed to open the input file.\n");
@@ -35,6 +106,9 @@ FILE* set_grid_dimens_from_file(life_t *life) {
 
 /**
  * Allocate memory for the current and next GoL board.
+ *
+ * On CPU, either board is a single aligned slab surrounded by a 1-cell thick frame of ghost cells, so that grid[-1][-1] up to
+ * grid[nrows][ncols] are all valid. The frame is only ever filled in by those evolution engines which rely on it.
  */
 void malloc_grid(life_t *life) {
     int ncols = life->ncols;
@@ -50,30 +124,9 @@ void malloc_grid(life_t *life) {
         exit(EXIT_FAILURE);
     }
     #else
-    int i;
-
-    life->grid      = (bool **) malloc(sizeof(bool *) * nrows);
-    life->next_grid = (bool **) malloc(sizeof(bool *) * nrows);
-
-    if (life->grid == NULL
-            || life->next_grid == NULL) {
-        perror("[*] GoL's board allocation failed!\n");
-        exit(EXIT_FAILURE);
-    }
-
-    #ifdef _OPENMP
-    #pragma omp parallel for
-    #endif
-    for (i = 0; i < nrows; i++) {
-        life->grid[i]      = (bool *) malloc(sizeof(bool) * (ncols));
-        life->next_grid[i] = (bool *) malloc(sizeof(bool) * (ncols));
-
-        if (life->grid[i] == NULL
-                || life->next_grid[i] == NULL) {
-            perror("[*] GoL's board allocation failed!\n");
-            exit(EXIT_FAILURE);
-        }
-    }
+    // Skip the top ghost row
+    life->grid      = malloc_frame(nrows, ncols, 1) + 1;
+    life->next_grid = malloc_frame(nrows, ncols, 1) + 1;
     #endif
 }
 
@@ -157,22 +210,59 @@ void init_from_file(life_t *life, FILE *file_ptr) {
     fclose(file_ptr);
 }
 
+#ifndef GoL_CUDA
 /**
- * Initialize the GoL board with ALIVE values randomly.
+ * Initialize the GoL board with ALIVE values from a binary board, whose header has already been read by
+ * set_grid_dimens_from_board().
+ *
+ * The board is mapped into memory rather than read, and its packed rows are unpacked straight from the page cache into GoL's board,
+ * split among threads, with no intermediate buffer nor parsing.
+ */
+void init_from_board(life_t *life) {
+    int i;
+
+    size_t size;
+
+    const board_header_t *header = map_board(life->board, &size);
+
+    if (header == NULL)
+        exit(EXIT_FAILURE);
+
+    if (header->nrows != life->nrows || header->ncols != life->ncols) {
+        fprintf(stderr, "[*] The binary GoL board has changed since it was first read!\n");
+        exit(EXIT_FAILURE);
+    }
+
+    #ifdef _OPENMP
+    #pragma omp parallel for
+    #endif
+    for (i = 0; i < life->nrows; i++)
+        unpack_row(board_row(header, i), life->ncols, life->grid[i]);
+
+    unmap_board(header, size);
+}
+#endif
+
+/**
+ * Initialize the GoL board with ALIVE values randomly. As every cell is generated on its own via rand_cell(), rows can be split
+ * among threads.
  */
 void init_random(life_t *life) {
     int i;
 
     #ifdef GoL_CUDA
     for (i = 0; i < life->nrows*life->ncols; i++)
-        if (rand_double(0., 1.) < life->init_prob)
+        if (rand_cell(life->seed, i / life->ncols, i % life->ncols) < life->init_prob)
             life->grid[i] = ALIVE;
     #else
     int j;
 
+    #ifdef _OPENMP
+    #pragma omp parallel for private(j)
+    #endif
     for (i = 0; i < life->nrows; i++) 
         for (j = 0; j < life->ncols; j++) { 
-            if (rand_double(0., 1.) < life->init_prob)
+            if (rand_cell(life->seed, i, j) < life->init_prob)
                 life->grid[i][j] = ALIVE;
         }
     #endif
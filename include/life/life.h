@@ -3,10 +3,13 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <sys/time.h>
 #include <unistd.h>
 
 // Custom includes
 #include "../globals.h"
+#include "../utils/func.h"
+#include "../utils/writer.h"
 
 /**
  * All the data required by a Game of Life instance.
@@ -21,14 +24,42 @@ typedef struct life {
 
     #ifdef _OPENMP
     int nthreads;      // Number of total OpenMP threads
+    int team;          // Organization of the threads across generations, see enum Teams
     #endif
 
     #ifdef GoL_CUDA
     int block_size;    // Number of threads per CUDA block
     #endif
 
+    #ifdef GoL_MPI
+    int proc_rows;     // Number of MPI processes along the rows of the grid of processes, or 0 to let MPI pick it
+    int proc_cols;     // Number of MPI processes along the columns of the grid of processes, or 0 to let MPI pick it
+    int halo_depth;    // Number of ghost rows exchanged at once by MPI processes, or HALO_AUTO to pick it from a probe
+    int output;        // How MPI processes write GoL's board to file, see enum Outputs
+    int rebalance;     // Number of generations between checks of the load balance of MPI processes, or 0 to never check it
+    int exchange;      // How MPI processes exchange ghost rows, see enum Exchanges
+    int wire;          // How rows go on the wire among MPI processes, see enum Wires
+    #endif
+
     unsigned int seed; // Random seed initializer
 
+    #ifndef GoL_CUDA
+    int engine;         // Evolution engine in use, see enum Engines
+    void *engine_state; // Engine-specific data structure, if any
+    int time_block;     // Number of generations per time block of the temporal engine
+    int checkpoint;     // Number of generations between checkpoints of the board, or 0 to never write them
+    char *restart;      // Checkpoint to restart the evolution from, if any
+    char *board;        // Binary board to load, i.e., the checkpoint to restart from or the input file, if binary, NULL otherwise
+    int generation;     // # of the generation the board starts from, i.e., 0 unless restarted from a checkpoint
+    int pattern;        // Format of the input file, if a pattern to place on the board, see enum Patterns
+    int pattern_row;    // Row of the board the top-left cell of the input pattern is placed at
+    int pattern_col;    // Column of the board the top-left cell of the input pattern is placed at
+    char *exportfile;   // Pattern file to export the final board to, if any
+    int dump;           // Number of generations between dumps of large boards, or 0 to only dump the initial and final ones
+    int queue_depth;    // Number of dumps that can be queued for the background writer at once
+    int backpressure;   // What to do when the queue of dumps is full, see enum Backpressures
+    #endif
+
     /*
      * When using CUDA, GoL's grid is defined as a 1D array rather than a 2D one. This choice derives from the logic behind the computation
      * of the neighborhood that's being adopted in CUDA. Check the evolve() function for more details.
@@ -42,6 +73,7 @@ typedef struct life {
     
     char *infile;      // Input filename
     char *outfile;     // Output filename
+    writer_t *writer;  // Writer of the output file, kept open for the whole run
 } life_t;
 
 /***********************
@@ -111,12 +143,33 @@ void debug(life_t life) {
 
     #ifdef _OPENMP
     printf("Number of total OpenMP threads: %d\n", life.nthreads);
+    printf("Thread team: %s\n", TEAM_NAMES[life.team]);
     #endif
 
     #ifdef GoL_CUDA
     printf("Number of threads per CUDA block: %d\n", life.block_size);
     #endif
 
+    #ifdef GoL_MPI
+    printf("Grid of MPI processes: %dx%d\n", life.proc_rows, life.proc_cols);
+    printf("Depth of the halo of MPI processes: %d\n", life.halo_depth);
+    printf("Output of MPI processes: %s\n", OUTPUT_NAMES[life.output]);
+    printf("Generations between load balance checks: %d\n", life.rebalance);
+    printf("Exchange of ghost rows: %s\n", EXCHANGE_NAMES[life.exchange]);
+    printf("Wire format of MPI messages: %s\n", WIRE_NAMES[life.wire]);
+    #endif
+
+    #ifndef GoL_CUDA
+    printf("Evolution engine: %s\n", ENGINE_NAMES[life.engine]);
+    printf("Number of generations per time block: %d\n", life.time_block);
+    printf("Generations between checkpoints: %d\n", life.checkpoint);
+    printf("Restart file: %s\n", life.restart == NULL ? "None" : life.restart);
+    printf("Input pattern: %s at %d,%d\n", PATTERN_NAMES[life.pattern], life.pattern_row, life.pattern_col);
+    printf("Export file: %s\n", life.exportfile == NULL ? "None" : life.exportfile);
+    printf("Generations between dumps: %d\n", life.dump);
+    printf("Queue of dumps: %d, %s when full\n", life.queue_depth, BACKPRESSURE_NAMES[life.backpressure]);
+    #endif
+
     printf("Input file: %s\n", life.infile == NULL ? "None" : life.infile);
     printf("Output file: %s\n\n", life.outfile);
 
@@ -172,47 +225,39 @@ void show(life_t life) {
 }
 
 /**
- * Print the current GoL board to file.
+ * Print the current GoL board to file, via the writer that is kept open for the whole run.
  *     1. A header will comprise the board dimensions (e.g., 6 6);
  *     2. A line filled with 'X' and ' ' will correspond to each row of GoL's board.
  * 
  * @param append    Whether to append to or to overwrite the output file.
  */
 void printbig(life_t life, bool append) {
-    int i, j;
+    int i;
     
     int ncols = life.ncols;
     int nrows = life.nrows;
 
-    FILE *out_ptr = append \
-        ? fopen(life.outfile, "a" ) \
-        : fopen(life.outfile, "w" );
+    struct timeval start, end;
 
-    if (out_ptr == NULL) {
-        perror("[*] Failed to open the output file.");
-        exit(EXIT_FAILURE);
-    }
-     
-    if (!append) // Print board dimensions only once
-        fprintf(out_ptr, "%d %d\n", nrows, ncols);
+    writer_t *writer = life.writer;
+
+    gettimeofday(&start, NULL);
+
+    begin_board(writer, life.outfile, nrows, ncols, append);
 
     for (i = 0; i < nrows; i++) {
-        for (j = 0; j < ncols; j++) {
-            #ifdef GoL_CUDA
-            fprintf(out_ptr, "%c", life.grid[i*ncols + j] == ALIVE
-                ? 'X' : ' ');
-            #else
-            fprintf(out_ptr, "%c", life.grid[i][j] == ALIVE
-                ? 'X' : ' ');
-            #endif
-        }  
-        fprintf(out_ptr, "\n");
+        #ifdef GoL_CUDA
+        write_row(writer, life.grid + i*ncols, ncols);
+        #else
+        write_row(writer, life.grid[i], ncols);
+        #endif
     }
 
-    fprintf(out_ptr, "****************************************************************************************************\n");
+    end_board(writer);
+
+    gettimeofday(&end, NULL);
 
-    fflush(out_ptr);
-    fclose(out_ptr);
+    writer->time += elapsed_wtime(start, end);
 }
 
 /**
@@ -0,0 +1,50 @@
+#ifndef GoL_LIFE_PATTERN_H
+#define GoL_LIFE_PATTERN_H
+
+#include <stdio.h>
+#include <stdlib.h>
+
+// Custom includes
+#include "life.h"
+#include "../utils/pattern.h"
+
+/**
+ * Initialize the GoL board with ALIVE values from the input pattern, placed at its offset, whose format has already been told by
+ * set_grid_dimens_from_file(). The board keeps the dimensions given on the command line.
+ */
+void init_from_pattern(life_t *life) {
+    pattern_window_t window;
+
+    window.rows     = life->grid;
+    window.row0     = 0;
+    window.col0     = 0;
+    window.nrows    = life->nrows;
+    window.ncols    = life->ncols;
+    window.tot_rows = life->nrows;
+    window.tot_cols = life->ncols;
+    window.off_row  = life->pattern_row;
+    window.off_col  = life->pattern_col;
+
+    if (!read_pattern(life->infile, life->pattern, &window))
+        exit(EXIT_FAILURE);
+}
+
+/**
+ * Export the current GoL board to the export file, as a pattern, one row at a time.
+ */
+void export_pattern(life_t life) {
+    int i;
+
+    pattern_writer_t writer;
+
+    if (!open_pattern(&writer, life.exportfile, life.nrows, life.ncols))
+        exit(EXIT_FAILURE);
+
+    for (i = 0; i < life.nrows; i++)
+        write_pattern_row(&writer, life.grid[i], life.ncols);
+
+    if (!close_pattern(&writer))
+        exit(EXIT_FAILURE);
+}
+
+#endif
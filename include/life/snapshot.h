@@ -0,0 +1,293 @@
+#ifndef GoL_LIFE_SNAPSHOT_H
+#define GoL_LIFE_SNAPSHOT_H
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/time.h>
+
+// Custom includes
+#include "life.h"
+#include "../utils/func.h"
+#include "../utils/writer.h"
+
+/**
+ * A queue of snapshots of large boards, i.e., dumps of GoL's board to the output file, at the start, every so many generations
+ * and at the end, which are written in the background.
+ *
+ * At a dump, the generation loop copies the board into a free slot of the queue, which is all it waits for, and goes on evolving,
+ * while a background thread prints the queued boards to the output file, oldest first, via the writer. A slot is only freed once
+ * its board is on file. When all slots are taken, the generation loop either waits for one, or skips the dump, as the backpressure
+ * policy says, but the initial and final boards are never skipped.
+ */
+typedef struct snapshots {
+    int period;            // Number of generations between dumps, or 0 to only dump the initial and final boards
+    int depth;             // Number of slots of the queue
+    int backpressure;      // What to do when all slots are taken, see enum Backpressures
+    bool active;           // Whether the board is large, thus its dumps go through the queue
+
+    int nrows, ncols;      // Dimensions of the board
+    char *outfile;         // Output file
+    writer_t *writer;      // Writer of the output file, only used by the background thread while the queue is active
+
+    bool **boards;         // Boards of the slots, each nrows x ncols cells, allocated on first use
+    bool *appends;         // Whether the board of each slot is appended to the output file
+    int head;              // Slot of the oldest board in the queue
+    int count;             // Number of boards in the queue, the one being printed included
+    bool done;             // Whether no more boards will be queued
+
+    int dropped;           // Number of dumps skipped, as all slots were taken
+    double wait_time;      // Time the generation loop spent waiting for free slots, in ms
+
+    pthread_mutex_t lock;  // Lock of the queue
+    pthread_cond_t queued; // Signalled when a board is queued, or no more will be
+    pthread_cond_t freed;  // Signalled when a slot is freed
+
+    pthread_t printer;     // Background thread printing the queued boards
+} snapshots_t;
+
+/**
+ * Print the queued boards to the output file, oldest first, until no more will be queued. It runs on the background thread.
+ */
+void* print_snapshots(void *arg) {
+    int i;
+
+    snapshots_t *snaps = (snapshots_t *) arg;
+
+    struct timeval start, end;
+
+    for (;;) {
+        pthread_mutex_lock(&snaps->lock);
+
+        while (snaps->count == 0 && !snaps->done)
+            pthread_cond_wait(&snaps->queued, &snaps->lock);
+
+        if (snaps->count == 0) { // All boards are on file
+            pthread_mutex_unlock(&snaps->lock);
+            return NULL;
+        }
+
+        int slot    = snaps->head;
+        bool append = snaps->appends[slot];
+
+        pthread_mutex_unlock(&snaps->lock);
+
+        // The slot is not reused until freed, thus it is printed out of the lock
+        bool *board = snaps->boards[slot];
+
+        gettimeofday(&start, NULL);
+
+        begin_board(snaps->writer, snaps->outfile, snaps->nrows, snaps->ncols, append);
+
+        for (i = 0; i < snaps->nrows; i++)
+            write_row(snaps->writer, board + (size_t) i * snaps->ncols, snaps->ncols);
+
+        end_board(snaps->writer);
+
+        gettimeofday(&end, NULL);
+
+        snaps->writer->time += elapsed_wtime(start, end);
+
+        // Free the slot
+        pthread_mutex_lock(&snaps->lock);
+
+        snaps->head = (snaps->head + 1) % snaps->depth;
+        snaps->count--;
+
+        pthread_cond_signal(&snaps->freed);
+        pthread_mutex_unlock(&snaps->lock);
+    }
+}
+
+/**
+ * Initialize the queue of snapshots once the board's dimensions are known, and start the background thread if the board is large.
+ */
+void init_snapshots(snapshots_t *snaps, life_t life) {
+    snaps->period       = life.dump;
+    snaps->depth        = life.queue_depth;
+    snaps->backpressure = life.backpressure;
+    snaps->active       = is_big(life);
+
+    snaps->nrows   = life.nrows;
+    snaps->ncols   = life.ncols;
+    snaps->outfile = life.outfile;
+    snaps->writer  = life.writer;
+
+    snaps->head      = 0;
+    snaps->count     = 0;
+    snaps->done      = false;
+    snaps->dropped   = 0;
+    snaps->wait_time = 0.;
+
+    // Small boards are shown on console instead
+    if (!snaps->active)
+        return;
+
+    snaps->boards  = (bool **) calloc(snaps->depth, sizeof(bool *));
+    snaps->appends = (bool *) calloc(snaps->depth, sizeof(bool));
+
+    if (snaps->boards == NULL || snaps->appends == NULL) {
+        perror("[*] Failed to allocate the queue of snapshots.");
+        exit(EXIT_FAILURE);
+    }
+
+    pthread_mutex_init(&snaps->lock, NULL);
+    pthread_cond_init(&snaps->queued, NULL);
+    pthread_cond_init(&snaps->freed, NULL);
+
+    if (pthread_create(&snaps->printer, NULL, print_snapshots, snaps) != 0) {
+        perror("[*] Failed to start printing the snapshots.");
+        exit(EXIT_FAILURE);
+    }
+}
+
+/**
+ * Evaluate whether a dump is due once the given generation is complete.
+ */
+bool is_snapshot(snapshots_t *snaps, int generation) {
+    return snaps->period > 0 && generation % snaps->period == 0;
+}
+
+/**
+ * Cap the number of generations evolved at once, so that they do not skip the next dump.
+ */
+int snapshot_steps(snapshots_t *snaps, int generation, int max_steps) {
+    if (snaps->period == 0)
+        return max_steps;
+
+    int left = snaps->period - generation % snaps->period;
+
+    return left < max_steps ? left : max_steps;
+}
+
+/**
+ * Take the next free slot of the queue, waiting for one if all are taken, unless the dump can be skipped.
+ *
+ * @param required    Whether the dump cannot be skipped, i.e., it is the initial or final one.
+ *
+ * @return slot    The slot to copy the board into, or -1 if the dump is skipped.
+ */
+int acquire_snapshot(snapshots_t *snaps, bool required) {
+    struct timeval start, end;
+
+    gettimeofday(&start, NULL);
+
+    pthread_mutex_lock(&snaps->lock);
+
+    while (snaps->count == snaps->depth) {
+        if (!required && snaps->backpressure == BACKPRESSURE_DROP) {
+            snaps->dropped++;
+
+            pthread_mutex_unlock(&snaps->lock);
+            return -1;
+        }
+
+        pthread_cond_wait(&snaps->freed, &snaps->lock);
+    }
+
+    // Only the generation loop queues boards, thus the slot stays free until committed
+    int slot = (snaps->head + snaps->count) % snaps->depth;
+
+    pthread_mutex_unlock(&snaps->lock);
+
+    gettimeofday(&end, NULL);
+
+    snaps->wait_time += elapsed_wtime(start, end);
+
+    if (snaps->boards[slot] == NULL
+            && posix_memalign((void **) &snaps->boards[slot], DEFAULT_ALIGNMENT,
+                              (size_t) snaps->nrows * snaps->ncols * sizeof(bool)) != 0) {
+        perror("[*] Failed to allocate the snapshot.");
+        exit(EXIT_FAILURE);
+    }
+
+    return slot;
+}
+
+/**
+ * Copy the rows in [from, to) of GoL's board into a slot taken by acquire_snapshot().
+ */
+void copy_snapshot(snapshots_t *snaps, int slot, bool **grid, int from, int to) {
+    int i;
+
+    for (i = from; i < to; i++)
+        memcpy(snaps->boards[slot] + (size_t) i * snaps->ncols, grid[i], snaps->ncols * sizeof(bool));
+}
+
+/**
+ * Queue the board copied into the slot for the background thread.
+ *
+ * @param append    Whether to append the board to or to overwrite the output file.
+ */
+void commit_snapshot(snapshots_t *snaps, int slot, bool append) {
+    pthread_mutex_lock(&snaps->lock);
+
+    snaps->appends[slot] = append;
+    snaps->count++;
+
+    pthread_cond_signal(&snaps->queued);
+    pthread_mutex_unlock(&snaps->lock);
+}
+
+/**
+ * Dump the current GoL board: large boards are copied into the queue and printed in the background, small ones are shown on console.
+ *
+ * @param append      Whether to append the board to or to overwrite the output file.
+ * @param required    Whether the dump cannot be skipped, i.e., it is the initial or final one.
+ */
+void save_snapshot(snapshots_t *snaps, life_t *life, bool append, bool required) {
+    int i;
+
+    if (!snaps->active) {
+        display(*life, append);
+        return;
+    }
+
+    int slot = acquire_snapshot(snaps, required);
+
+    if (slot == -1)
+        return;
+
+    #ifdef _OPENMP
+    #pragma omp parallel for
+    #endif
+    for (i = 0; i < life->nrows; i++)
+        copy_snapshot(snaps, slot, life->grid, i, i + 1);
+
+    commit_snapshot(snaps, slot, append);
+}
+
+/**
+ * Wait until all queued boards are on file, stop the background thread, and free the queue.
+ */
+void free_snapshots(snapshots_t *snaps) {
+    int slot;
+
+    if (!snaps->active)
+        return;
+
+    pthread_mutex_lock(&snaps->lock);
+
+    snaps->done = true;
+
+    pthread_cond_signal(&snaps->queued);
+    pthread_mutex_unlock(&snaps->lock);
+
+    pthread_join(snaps->printer, NULL);
+
+    printf("Waited %.5f ms for free slots of the queue of snapshots, %d dumps skipped\n",
+            snaps->wait_time, snaps->dropped);
+
+    for (slot = 0; slot < snaps->depth; slot++)
+        free(snaps->boards[slot]);
+
+    free(snaps->boards);
+    free(snaps->appends);
+
+    pthread_mutex_destroy(&snaps->lock);
+    pthread_cond_destroy(&snaps->queued);
+    pthread_cond_destroy(&snaps->freed);
+}
+
+#endif
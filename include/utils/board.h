@@ -0,0 +1,185 @@
+#ifndef GoL_UTILS_BOARD_H
+#define GoL_UTILS_BOARD_H
+
+#include <fcntl.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// Custom includes
+#include "../globals.h"
+#include "pack.h"
+
+/*
+ * Binary file format of GoL's board, e.g., of checkpoints: a header of DEFAULT_ALIGNMENT bytes, followed by the rows of the board
+ * packed via pack_row(), each of which is padded to a multiple of DEFAULT_ALIGNMENT bytes. Thus, the i-th row starts at byte
+ * sizeof(board_header_t) + i * board_row_words(ncols) * 8 of the file, and any block of the board can be read without the others.
+ * Words are stored in the byte order of the machine, i.e., little-endian on x86.
+ */
+
+// First bytes of every binary board, and version of its format
+const char BOARD_MAGIC[8]     = "GoLbin\n";
+const uint32_t BOARD_VERSION  = 1;
+
+/**
+ * Header of a binary board.
+ */
+typedef struct board_header {
+    char magic[8];        // BOARD_MAGIC
+    uint32_t version;     // BOARD_VERSION
+    uint32_t birth;       // Numbers of ALIVE neighbours for which a DEAD cell is born, as a bitmask, i.e., RULE_BIRTH
+    uint32_t survival;    // Numbers of ALIVE neighbours for which an ALIVE cell survives, as a bitmask, i.e., RULE_SURVIVAL
+    uint32_t seed;        // Random seed initializer of the board
+    int64_t nrows;        // Number of rows of the board
+    int64_t ncols;        // Number of columns of the board
+    int64_t generation;   // # of generations the board has evolved for
+    uint8_t padding[16];  // Up to DEFAULT_ALIGNMENT bytes
+} board_header_t;
+
+/**
+ * Evaluate the number of words a packed row of ncols cells takes in a binary board, padding included.
+ */
+size_t board_row_words(int64_t ncols) {
+    size_t align = DEFAULT_ALIGNMENT / sizeof(uint64_t);
+
+    return ((ncols + 63) / 64 + align - 1) / align * align;
+}
+
+/**
+ * Fill in the header of a binary board of GoL's rule.
+ */
+void init_board_header(board_header_t *header, int64_t nrows, int64_t ncols,
+        int64_t generation, unsigned int seed) {
+    memset(header, 0, sizeof(board_header_t));
+    memcpy(header->magic, BOARD_MAGIC, sizeof(BOARD_MAGIC));
+
+    header->version    = BOARD_VERSION;
+    header->birth      = RULE_BIRTH;
+    header->survival   = RULE_SURVIVAL;
+    header->seed       = seed;
+    header->nrows      = nrows;
+    header->ncols      = ncols;
+    header->generation = generation;
+}
+
+/**
+ * Check that the header of a binary board is that of a valid board of GoL's rule.
+ *
+ * @return valid    Whether the header is valid, otherwise the reason is printed to stderr.
+ */
+bool check_board_header(const board_header_t *header) {
+    if (memcmp(header->magic, BOARD_MAGIC, sizeof(BOARD_MAGIC)) != 0) {
+        fprintf(stderr, "[*] The file is not a binary GoL board!\n");
+        return false;
+    }
+
+    if (header->version != BOARD_VERSION) {
+        fprintf(stderr, "[*] Unsupported version of the binary GoL board: %u\n", header->version);
+        return false;
+    }
+
+    if (header->birth != RULE_BIRTH || header->survival != RULE_SURVIVAL) {
+        fprintf(stderr, "[*] The binary GoL board follows another rule than B3/S23!\n");
+        return false;
+    }
+
+    if (header->nrows <= 0 || header->ncols <= 0 || header->generation < 0) {
+        fprintf(stderr, "[*] The binary GoL board has invalid dimensions!\n");
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * Evaluate whether a file is a binary board, i.e., whether it starts with BOARD_MAGIC, rather than a board in FM format.
+ */
+bool is_board(const char *path) {
+    char magic[sizeof(BOARD_MAGIC)];
+
+    FILE *file_ptr = fopen(path, "rb");
+
+    if (file_ptr == NULL)
+        return false;
+
+    bool board = fread(magic, sizeof(magic), 1, file_ptr) == 1
+              && memcmp(magic, BOARD_MAGIC, sizeof(BOARD_MAGIC)) == 0;
+
+    fclose(file_ptr);
+
+    return board;
+}
+
+/**
+ * Map a binary board into memory, read-only, and check that it is a valid board of GoL's rule and that it holds all of its rows.
+ * Its rows start right past the header, and are only read from disk, straight into the page cache, once they are first touched.
+ *
+ * @param size      The size of the mapping, to be passed to unmap_board().
+ *
+ * @return header   The header of the mapped board, followed by its rows, or NULL if invalid, in which case the reason is printed.
+ */
+const board_header_t* map_board(const char *path, size_t *size) {
+    struct stat info;
+
+    int fd = open(path, O_RDONLY);
+
+    if (fd == -1 || fstat(fd, &info) == -1) {
+        perror("[*] Failed to open the binary GoL board.");
+        return NULL;
+    }
+
+    *size = (size_t) info.st_size;
+
+    if (*size < sizeof(board_header_t)) {
+        fprintf(stderr, "[*] The file is not a binary GoL board!\n");
+        close(fd);
+        return NULL;
+    }
+
+    void *data = mmap(NULL, *size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+    // The mapping outlives the file descriptor
+    close(fd);
+
+    if (data == MAP_FAILED) {
+        perror("[*] Failed to map the binary GoL board.");
+        return NULL;
+    }
+
+    // All rows are about to be read, thus read them ahead
+    madvise(data, *size, MADV_WILLNEED);
+
+    const board_header_t *header = (const board_header_t *) data;
+
+    if (!check_board_header(header)) {
+        munmap(data, *size);
+        return NULL;
+    }
+
+    if (*size < sizeof(board_header_t) + (size_t) header->nrows * board_row_words(header->ncols) * sizeof(uint64_t)) {
+        fprintf(stderr, "[*] The binary GoL board does not respect the number of rows!\n");
+        munmap(data, *size);
+        return NULL;
+    }
+
+    return header;
+}
+
+/**
+ * Evaluate where the i-th packed row of a mapped binary board starts.
+ */
+const uint64_t* board_row(const board_header_t *header, int64_t i) {
+    return (const uint64_t *) (header + 1) + i * board_row_words(header->ncols);
+}
+
+/**
+ * Unmap a binary board mapped via map_board().
+ */
+void unmap_board(const board_header_t *header, size_t size) {
+    munmap((void *) header, size);
+}
+
+#endif
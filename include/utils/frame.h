@@ -0,0 +1,137 @@
+#ifndef GoL_FRAME_H
+#define GoL_FRAME_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Custom includes
+#include "../globals.h"
+
+/**
+ * Round n up to the closest multiple of DEFAULT_ALIGNMENT.
+ */
+size_t align_up(size_t n) {
+    return (n + DEFAULT_ALIGNMENT - 1) / DEFAULT_ALIGNMENT * DEFAULT_ALIGNMENT;
+}
+
+/**
+ * Offset in bytes of the 1st non-ghost column from the start of a framed row. It keeps said column aligned.
+ */
+size_t frame_offset(int ghost) {
+    return align_up(ghost);
+}
+
+/**
+ * Number of cells between the starts of two consecutive rows of a frame, which keeps every row aligned.
+ */
+size_t frame_stride(int ncols, int ghost) {
+    return align_up(frame_offset(ghost) + ncols + ghost);
+}
+
+/**
+ * Size in bytes of the slab that holds a frame of nrows x ncols cells, ghost cells included.
+ */
+size_t frame_size(int nrows, int ncols, int ghost) {
+    return frame_stride(ncols, ghost) * (nrows + 2*ghost);
+}
+
+/**
+ * Lay out a frame of nrows x ncols DEAD cells over an aligned slab of frame_size() bytes, which is owned by the caller.
+ *
+ * @return frame    The array of nrows + 2*ghost row pointers, starting from the topmost ghost row.
+ */
+bool** frame_rows(bool *data, int nrows, int ncols, int ghost) {
+    int i;
+
+    size_t offset = frame_offset(ghost);
+    size_t stride = frame_stride(ncols, ghost);
+
+    bool **frame = (bool **) malloc(sizeof(bool *) * (nrows + 2*ghost));
+
+    if (frame == NULL) {
+        perror("[*] GoL's board allocation failed!\n");
+        exit(EXIT_FAILURE);
+    }
+
+    // 1. Ghost rows, which are few, are touched by the calling thread...
+    for (i = 0; i < ghost; i++) {
+        memset(data + stride*i, DEAD, stride);
+        memset(data + stride*(nrows + ghost + i), DEAD, stride);
+    }
+
+    // 2. ...whereas every other row is first touched by the thread that evolves it, with the same schedule as the evolve loops,
+    // so that its pages sit on that thread's NUMA node
+    #ifdef _OPENMP
+    #pragma omp parallel for
+    #endif
+    for (i = 0; i < nrows; i++)
+        memset(data + stride*(ghost + i), DEAD, stride);
+
+    for (i = 0; i < nrows + 2*ghost; i++)
+        frame[i] = &(data[stride*i + offset]);
+
+    return frame;
+}
+
+/**
+ * Allocate a 2D matrix of nrows x ncols DEAD cells as a single aligned slab, surrounded by a frame of ghost cells that is `ghost` cells thick.
+ *
+ * Rows sit next to each other in memory, each one starting on a new cache line. Every row pointer points to the 1st non-ghost column
+ * of its row, so that columns from -ghost to ncols + ghost - 1 can be accessed with no further index arithmetic.
+ *
+ * @return frame    The array of nrows + 2*ghost row pointers, starting from the topmost ghost row.
+ */
+bool** malloc_frame(int nrows, int ncols, int ghost) {
+    bool *data = NULL;
+
+    if (posix_memalign((void **) &data, DEFAULT_ALIGNMENT, frame_size(nrows, ncols, ghost)) != 0) {
+        perror("[*] GoL's board allocation failed!\n");
+        exit(EXIT_FAILURE);
+    }
+
+    return frame_rows(data, nrows, ncols, ghost);
+}
+
+/**
+ * Free a 2D matrix previously allocated by malloc_frame().
+ *
+ * @param frame    The array of row pointers, starting from the topmost ghost row.
+ */
+void free_frame(bool **frame, int ghost) {
+    free(frame[0] - frame_offset(ghost));
+    free(frame);
+}
+
+/**
+ * Refresh the ghost columns of the rows in [from, to) by wrapping around their opposite ends, as GoL's board is toroidal.
+ */
+void wrap_frame_cols(bool **rows, int from, int to, int ncols, int ghost) {
+    int i, c;
+
+    for (i = from; i < to; i++)
+        for (c = 1; c <= ghost; c++) {
+            rows[i][-c]            = rows[i][ncols - c];
+            rows[i][ncols - 1 + c] = rows[i][c - 1];
+        }
+}
+
+/**
+ * Refresh the whole ghost frame of a toroidal nrows x ncols board, corners included, by wrapping around its opposite borders.
+ *
+ * @param rows    The array of row pointers, starting from the 1st non-ghost row.
+ */
+void wrap_frame(bool **rows, int nrows, int ncols, int ghost) {
+    int r;
+
+    // 1. Left/right ghost columns of the non-ghost rows...
+    wrap_frame_cols(rows, 0, nrows, ncols, ghost);
+
+    // 2. ...which the top/bottom ghost rows copy along, filling the corners in
+    for (r = 1; r <= ghost; r++) {
+        memcpy(rows[-r] - ghost, rows[nrows - r] - ghost, ncols + 2*ghost);
+        memcpy(rows[nrows - 1 + r] - ghost, rows[r - 1] - ghost, ncols + 2*ghost);
+    }
+}
+
+#endif
@@ -1,6 +1,7 @@
 #ifndef GoL_FUNC_H
 #define GoL_FUNC_H
 
+#include <stdint.h>
 #include <stdlib.h>
 
 #ifdef GoL_CUDA
@@ -10,15 +11,28 @@
 #include <time.h>
 
 /**
- * Generate a random double from min to max.
+ * Scramble a 64-bit value into a uniformly distributed one, as the output function of SplitMix64 does.
+ */
+static inline uint64_t splitmix64(uint64_t x) {
+    x += 0x9E3779B97F4A7C15ULL;
+    x  = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    x  = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+
+    return x ^ (x >> 31);
+}
+
+/**
+ * Generate a random double from 0 to 1 for the cell at (row, col) of GoL's board.
  * 
- * Please, note that RAND_MAX returns a 32 bit integer, whereas a double has 53 bits of mantissa, by IEEE-754 standard. This means that there may be many more double values left out in the specified range which are not yet covered by this implementation.
+ * The generator is counter-based, i.e., the value is a hash of (seed, row, col) rather than the next one of a sequence, so that any
+ * process or thread can generate its own cells only, in any order, and the board is the same whatever the number of them.
  */
-double rand_double(double min, double max) {
-    double range = max - min;
-    double div = RAND_MAX / range;
+double rand_cell(unsigned int seed, int row, int col) {
+    uint64_t x = splitmix64(((uint64_t) seed << 32) | (uint32_t) row);
+
+    x = splitmix64(x ^ (uint32_t) col);
 
-    return min + (double) random() / div;
+    return (double) (x >> 11) / 9007199254740992.; // 53 bits of mantissa, i.e., / 2^53
 }
 
 /**
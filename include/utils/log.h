@@ -16,12 +16,20 @@
 #include "../globals.h"
 #include "../life/life.h"
 
+#ifdef GoL_MPI
+#include "../chunk/chunk.h"
+#endif
+
 /**
  * Initialize a tab-separated log file, whose name varies with GoL configuration's settings. Each row will have a fixed a priori set of (timesteps, cum_gene_time, tot_prog_time) columns, where:
  * 
  * - timesteps        The # of elapsed generations
  * - cum_gene_time    The total time devolved to GoL evolution
  * - tot_prog_time    The total runtime of the program
+ *
+ * With MPI, each row also has the (min, avg, max) times across processes of every phase of GoL evolution, see enum Phases, followed
+ * by the load imbalance of the compute phase. Each row ends with the (out_bytes, out_time, out_bw) columns, i.e., the bytes of GoL's
+ * board written to the output file, the time spent formatting and writing them, and their ratio in MB/s.
  * 
  * @param nprocs      The # of running processes | 1
  * 
@@ -30,15 +38,16 @@
 FILE* init_log_file(life_t life, int nprocs) {
     char *logs_dir = (char*) DEFAULT_LOGS_DIR;
 
-    char buffer[100];
+    char buffer[160];
 
     // GoL configuration's tags
-    char __omp[7];   // 7  := "omp"  + 3-digit nthreads + "_"
+    char __omp[18];  // 18 := "omp"  + 3-digit nthreads + "_" + team name + "_"
     char __mpi[8];   // 8  := "mpi"  + 4-digit nprocs   + "_"
     char __cuda[15]; // 15 := "cuda" + 5-digit nblocks  + "_" + 4-digit block_size + "_"
+    char __eng[16];  // 16 := Engine name + "_"
 
     #ifdef _OPENMP
-    sprintf(__omp, "omp%d_", life.nthreads);
+    sprintf(__omp, "omp%d_%s_", life.nthreads, TEAM_NAMES[life.team]);
     #else
     sprintf(__omp, "");
     #endif
@@ -55,6 +64,12 @@ FILE* init_log_file(life_t life, int nprocs) {
     sprintf(__cuda, "");
     #endif
 
+    #ifndef GoL_CUDA
+    sprintf(__eng, "%s_", ENGINE_NAMES[life.engine]);
+    #else
+    sprintf(__eng, "");
+    #endif
+
     struct stat st = {0};
 
     // Create the logs dir if it doesn't exist​​​​
@@ -63,18 +78,30 @@ FILE* init_log_file(life_t life, int nprocs) {
     }
 
     if (life.infile != NULL)
-        sprintf(buffer, "%s/GoL_%s%s%snc%d_nr%d_nt%d_%lu.log",
-                logs_dir, __mpi, __omp, __cuda, 
+        sprintf(buffer, "%s/GoL_%s%s%s%snc%d_nr%d_nt%d_%lu.log",
+                logs_dir, __mpi, __omp, __cuda, __eng,
                 life.ncols, life.nrows, life.timesteps,
                 (unsigned long) time(NULL));
     else
-        sprintf(buffer, "%s/GoL_%s%s%snc%d_nr%d_nt%d_prob%.1f_seed%d_%lu.log",
-                logs_dir, __mpi, __omp, __cuda,
+        sprintf(buffer, "%s/GoL_%s%s%s%snc%d_nr%d_nt%d_prob%.1f_seed%d_%lu.log",
+                logs_dir, __mpi, __omp, __cuda, __eng,
                 life.ncols, life.nrows, life.timesteps, life.init_prob,
                 life.seed, (unsigned long) time(NULL));
 
     FILE *log_ptr = fopen(buffer, "a");
-    fprintf(log_ptr, "timesteps\tcum_gene_time\ttot_prog_time\n");
+    fprintf(log_ptr, "timesteps\tcum_gene_time\ttot_prog_time");
+
+    #ifdef GoL_MPI
+    int p;
+
+    for (p = 0; p < NUM_PHASES; p++)
+        fprintf(log_ptr, "\t%s_min\t%s_avg\t%s_max",
+                PHASE_NAMES[p], PHASE_NAMES[p], PHASE_NAMES[p]);
+
+    fprintf(log_ptr, "\timbalance");
+    #endif
+
+    fprintf(log_ptr, "\tout_bytes\tout_time\tout_bw\n");
 
     // The log file's name is guaranteed to be unique until year 2038,
     // as it implies the call to time(NULL).
@@ -82,14 +109,33 @@ FILE* init_log_file(life_t life, int nprocs) {
 }
 
 /**
- * Log a (timesteps, cum_gene_time, tot_prog_time) triplet onto the log file.
+ * Log a (timesteps, cum_gene_time, tot_prog_time) triplet onto the log file, followed by the phase times across processes with MPI.
  * 
  * @param timesteps        The # of elapsed generations
  * @param cum_gene_time    The total time devolved to GoL evolution
  * @param tot_prog_time    The total runtime of the program
+ * @param timings          The phase times of GoL evolution across all processes
+ * @param writer           The writer of the output file, with the bytes and time of all processes
  */
-void log_data(FILE *log_ptr, int timesteps, double cum_gene_time, double tot_prog_time) {
-    fprintf(log_ptr, "%-9d\t%-13.3f\t%-13.3f\n", timesteps, cum_gene_time, tot_prog_time); // -13, as columns are 13-char long
+#ifdef GoL_MPI
+void log_data(FILE *log_ptr, int timesteps, double cum_gene_time, double tot_prog_time, timings_t timings, writer_t writer) {
+#else
+void log_data(FILE *log_ptr, int timesteps, double cum_gene_time, double tot_prog_time, writer_t writer) {
+#endif
+    fprintf(log_ptr, "%-9d\t%-13.3f\t%-13.3f", timesteps, cum_gene_time, tot_prog_time); // -13, as columns are 13-char long
+
+    #ifdef GoL_MPI
+    int p;
+
+    for (p = 0; p < NUM_PHASES; p++)
+        fprintf(log_ptr, "\t%-13.3f\t%-13.3f\t%-13.3f",
+                timings.min[p], timings.avg[p], timings.max[p]);
+
+    fprintf(log_ptr, "\t%-9.2f", imbalance(timings, PHASE_COMPUTE));
+    #endif
+
+    fprintf(log_ptr, "\t%-13.0f\t%-13.3f\t%-13.3f\n",
+            writer.bytes, writer.time, writer_bandwidth(writer));
 }
 
 #endif
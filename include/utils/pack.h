@@ -0,0 +1,130 @@
+#ifndef GoL_UTILS_PACK_H
+#define GoL_UTILS_PACK_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+// Custom includes
+#include "../globals.h"
+
+/*
+ * Rows of bool cells are packed 64 cells per word, as in ENGINE_BITPACK, i.e., the j-th cell of a row is the (j % 64)-th bit of its
+ * (j / 64)-th word. Cells are packed and unpacked 8 at a time, by loading 8 bools as a little-endian word and gathering/scattering
+ * their lowest bits with a multiplication, as on x86.
+ */
+
+/**
+ * Pack up to 64 cells into a word.
+ */
+static inline uint64_t pack_word(const bool *cells, int n) {
+    int k, j;
+
+    uint64_t word = 0;
+
+    for (k = 0; k + 8 <= n; k += 8) {
+        uint64_t bytes;
+
+        memcpy(&bytes, cells + k, sizeof(uint64_t));
+
+        // The lowest bit of the i-th byte lands on the (56 + i)-th bit
+        word |= ((bytes * 0x0102040810204080ULL) >> 56) << k;
+    }
+
+    for (j = k; j < n; j++)
+        word |= (uint64_t) cells[j] << j;
+
+    return word;
+}
+
+/**
+ * Unpack up to 64 cells from a word.
+ */
+static inline void unpack_word(uint64_t word, int n, bool *cells) {
+    int k, j;
+
+    for (k = 0; k + 8 <= n; k += 8) {
+        // The i-th bit lands on the i-th byte, which is then set to 0 or 1
+        uint64_t bytes = (((word >> k) & 0xFF) * 0x0101010101010101ULL) & 0x8040201008040201ULL;
+
+        bytes = ((bytes + 0x7F7F7F7F7F7F7F7FULL) >> 7) & 0x0101010101010101ULL;
+
+        memcpy(cells + k, &bytes, sizeof(uint64_t));
+    }
+
+    for (j = k; j < n; j++)
+        cells[j] = (word >> j) & 1 ? ALIVE : DEAD;
+}
+
+/**
+ * Pack a row of ncols cells 64 cells per word.
+ *
+ * @return alive    Whether any cell in the row is ALIVE.
+ */
+bool pack_row(const bool *row, int ncols, uint64_t *words) {
+    int j;
+
+    uint64_t any = 0;
+
+    for (j = 0; j < ncols; j += 64) {
+        words[j / 64] = pack_word(row + j, ncols - j < 64 ? ncols - j : 64);
+        any |= words[j / 64];
+    }
+
+    return any != 0;
+}
+
+/**
+ * Unpack a row of ncols cells packed 64 cells per word.
+ */
+void unpack_row(const uint64_t *words, int ncols, bool *row) {
+    int j;
+
+    for (j = 0; j < ncols; j += 64)
+        unpack_word(words[j / 64], ncols - j < 64 ? ncols - j : 64, row + j);
+}
+
+/**
+ * Pack a row of ncols cells into the bits of a wider row from the given offset onwards, e.g., a block of a process into a whole
+ * row of the board. The bits are OR-ed into the words, which must have been zeroed.
+ */
+void pack_row_at(const bool *row, int ncols, uint64_t *words, long offset) {
+    int j;
+
+    for (j = 0; j < ncols; j += 64) {
+        int n = ncols - j < 64 ? ncols - j : 64;
+
+        long bit = offset + j;
+        int s    = bit % 64;
+
+        uint64_t word = pack_word(row + j, n);
+
+        words[bit / 64] |= word << s;
+
+        if (s > 0 && s + n > 64)
+            words[bit / 64 + 1] |= word >> (64 - s);
+    }
+}
+
+/**
+ * Unpack a row of ncols cells from the bits of a wider row from the given offset onwards.
+ */
+void unpack_row_at(const uint64_t *words, long offset, int ncols, bool *row) {
+    int j;
+
+    for (j = 0; j < ncols; j += 64) {
+        int n = ncols - j < 64 ? ncols - j : 64;
+
+        long bit = offset + j;
+        int s    = bit % 64;
+
+        uint64_t word = words[bit / 64] >> s;
+
+        if (s > 0 && s + n > 64)
+            word |= words[bit / 64 + 1] << (64 - s);
+
+        unpack_word(word, n, row + j);
+    }
+}
+
+#endif
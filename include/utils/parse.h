@@ -16,7 +16,7 @@
 #include "../globals.h"
 #include "../life/life.h"
 
-static const char *short_opts = "c:r:t:i:s::n:o:p:h?";
+static const char *short_opts = "c:r:t:i:s::n:m:g:d:w:l:x:f:o:p:e:k:v:u:a:y:j:q:z:h?";
 static const struct option long_opts[] = {
     { "columns", required_argument, NULL, 'c' },
     { "rows", required_argument, NULL, 'r' },
@@ -25,12 +25,32 @@ static const struct option long_opts[] = {
     { "input", required_argument, NULL, 'i' },
     #ifdef _OPENMP
     { "nthreads", required_argument, NULL, 'n' },
+    { "team", required_argument, NULL, 'm' },
     #endif
     #ifdef GoL_CUDA
     { "block_size", required_argument, NULL, 'b' },
     #endif
+    #ifdef GoL_MPI
+    { "proc_grid", required_argument, NULL, 'g' },
+    { "halo_depth", required_argument, NULL, 'd' },
+    { "write", required_argument, NULL, 'w' },
+    { "rebalance", required_argument, NULL, 'l' },
+    { "exchange", required_argument, NULL, 'x' },
+    { "wire", required_argument, NULL, 'f' },
+    #endif
     { "seed", required_argument, NULL, 's' },
     { "init_prob", required_argument, NULL, 'p' },
+    #ifndef GoL_CUDA
+    { "engine", required_argument, NULL, 'e' },
+    { "time_block", required_argument, NULL, 'k' },
+    { "checkpoint_every", required_argument, NULL, 'v' },
+    { "restart", required_argument, NULL, 'u' },
+    { "offset", required_argument, NULL, 'a' },
+    { "export", required_argument, NULL, 'y' },
+    { "dump_every", required_argument, NULL, 'j' },
+    { "queue_depth", required_argument, NULL, 'q' },
+    { "backpressure", required_argument, NULL, 'z' },
+    #endif
     { "help", no_argument, NULL, 'h' },
     { NULL, no_argument, NULL, 0 }
 };
@@ -47,11 +67,31 @@ void show_usage() {
     printf("  -p|--init_prob   number      Probability for grid initialization. Default: %f\n", DEFAULT_INIT_PROB);
     #ifdef _OPENMP 
     printf("  -n|--nthreads    number      Number of threads adopted by OpenMP. Default: %d\n", DEFAULT_NUM_THREADS);
+    printf("  -m|--team        name        Thread team: fork, persistent. Default: %s\n", TEAM_NAMES[DEFAULT_TEAM]);
     #endif 
     #ifdef GoL_CUDA 
     printf("  -b|--block_size  number      Number of threads per CUDA block. Default: %d\n", DEFAULT_BLOCK_SIZE);
     #endif 
-    printf("  -i|--input       filename    Input file. See README for format. Default: None.\n");
+    #ifdef GoL_MPI
+    printf("  -g|--proc_grid   RxC         Grid of MPI processes, R rows by C columns, either of which can be 0 to let MPI pick it. Default: 0x0\n");
+    printf("  -d|--halo_depth  number|auto Number of ghost rows exchanged at once by MPI processes, every as many generations. Default: %d\n", DEFAULT_HALO_DEPTH);
+    printf("  -w|--write       name        Output of MPI processes to file: gather, collective. Default: %s\n", OUTPUT_NAMES[DEFAULT_OUTPUT]);
+    printf("  -l|--rebalance   number      Number of generations between checks of the load balance of MPI processes, 0 to never check it. Default: %d\n", DEFAULT_REBALANCE_PERIOD);
+    printf("  -x|--exchange    name        Exchange of ghost rows among MPI processes on the same node: message, shared. Default: %s\n", EXCHANGE_NAMES[DEFAULT_EXCHANGE]);
+    printf("  -f|--wire        name        Wire format of ghost row and gather messages among MPI processes: bytes, packed. Default: %s\n", WIRE_NAMES[DEFAULT_WIRE]);
+    #endif
+    #ifndef GoL_CUDA
+    printf("  -e|--engine      name        Evolution engine: naive, bitpack, padded, simd, lut, colsum, tiled, hashlife, sparse, auto, temporal. Default: %s\n", ENGINE_NAMES[DEFAULT_ENGINE]);
+    printf("  -k|--time_block  number      Number of generations per time block of the temporal engine. Default: %d\n", DEFAULT_TIME_BLOCK);
+    printf("  -v|--checkpoint_every number Number of generations between checkpoints of the board, 0 to never write them. Default: %d\n", DEFAULT_CHECKPOINT_PERIOD);
+    printf("  -u|--restart     filename    Checkpoint to restart the evolution from, up to the same number of timesteps. Default: None.\n");
+    printf("  -a|--offset      R,C         Cell of the board the top-left cell of an RLE or Life 1.06 input pattern is placed at. Default: 0,0\n");
+    printf("  -y|--export      filename    Pattern file to export the final board to, in Life 1.06 format if .lif or .life, RLE otherwise. Default: None.\n");
+    printf("  -j|--dump_every  number      Number of generations between dumps of large boards to the output file, 0 to only dump the initial and final ones. Default: %d\n", DEFAULT_DUMP_PERIOD);
+    printf("  -q|--queue_depth number      Number of dumps queued for the background writer at once. Default: %d\n", DEFAULT_QUEUE_DEPTH);
+    printf("  -z|--backpressure name       What to do when the queue of dumps is full: wait, drop. Default: %s\n", BACKPRESSURE_NAMES[DEFAULT_BACKPRESSURE]);
+    #endif
+    printf("  -i|--input       filename    Input file, in FM, binary, RLE or Life 1.06 format. See README for format. Default: None.\n");
     printf("  -o|--output      filename    Output file. Default: %s.\n", DEFAULT_OUT_FILE);
     printf("  -h|--help                    Show this help page.\n\n");
 
@@ -100,9 +140,34 @@ void load_defaults(life_t *life) {
     life->init_prob  = DEFAULT_INIT_PROB;
     #ifdef _OPENMP
     life->nthreads   = DEFAULT_NUM_THREADS;
+    life->team       = DEFAULT_TEAM;
+    #endif
+    #ifdef GoL_MPI
+    life->proc_rows  = 0;
+    life->proc_cols  = 0;
+    life->halo_depth = DEFAULT_HALO_DEPTH;
+    life->output     = DEFAULT_OUTPUT;
+    life->rebalance  = DEFAULT_REBALANCE_PERIOD;
+    life->exchange   = DEFAULT_EXCHANGE;
+    life->wire       = DEFAULT_WIRE;
     #endif
     #ifdef GoL_CUDA
     life->block_size = DEFAULT_BLOCK_SIZE;
+    #else
+    life->engine       = DEFAULT_ENGINE;
+    life->engine_state = NULL;
+    life->time_block   = DEFAULT_TIME_BLOCK;
+    life->checkpoint   = DEFAULT_CHECKPOINT_PERIOD;
+    life->restart      = NULL;
+    life->board        = NULL;
+    life->pattern      = PATTERN_NONE;
+    life->pattern_row  = 0;
+    life->pattern_col  = 0;
+    life->exportfile   = NULL;
+    life->dump         = DEFAULT_DUMP_PERIOD;
+    life->queue_depth  = DEFAULT_QUEUE_DEPTH;
+    life->backpressure = DEFAULT_BACKPRESSURE;
+    life->generation   = 0;
     #endif
     life->infile     = NULL;
     life->outfile    = (char*) DEFAULT_OUT_FILE;
@@ -139,6 +204,26 @@ int parse_nthreads(char *_nthreads) {
         ? DEFAULT_MAX_THREADS : nthreads;
 
 }
+
+/**
+ * Parse the organization of the threads across generations.
+ * 
+ * @param _team    The command line argument.
+ * 
+ * @return    The corresponding team in enum Teams. Unknown names will show usage and terminate.
+ */ 
+int parse_team(char *_team) {
+    int team;
+
+    for (team = 0; team < NUM_TEAMS; team++)
+        if (strcmp(_team, TEAM_NAMES[team]) == 0)
+            return team;
+
+    fprintf(stderr, "\n[*] Unknown thread team: %s\n", _team);
+    show_usage();
+
+    return DEFAULT_TEAM;
+}
 #endif
 
 #ifdef GoL_CUDA
@@ -158,6 +243,226 @@ int parse_block_size(char *_block_size) {
 }
 #endif
 
+#ifdef GoL_MPI
+/**
+ * Parse the grid of MPI processes, given as RxC, e.g., 4x8 for 4 rows by 8 columns of processes.
+ * 
+ * @param _proc_grid    The command line argument.
+ * 
+ * Malformed grids will show usage and terminate.
+ */ 
+void parse_proc_grid(life_t *life, char *_proc_grid) {
+    if (sscanf(_proc_grid, "%dx%d", &life->proc_rows, &life->proc_cols) != 2
+            || life->proc_rows < 0 || life->proc_cols < 0) {
+        fprintf(stderr, "\n[*] Malformed grid of MPI processes: %s\n", _proc_grid);
+        show_usage();
+    }
+}
+
+/**
+ * Parse the number of ghost rows exchanged at once by MPI processes.
+ * 
+ * @param _halo_depth    The command line argument, either a number or auto.
+ * 
+ * @return    The corresponding number of ghost rows, 1 if the number is smaller than it, or HALO_AUTO.
+ */ 
+int parse_halo_depth(char *_halo_depth) {
+    if (strcmp(_halo_depth, "auto") == 0)
+        return HALO_AUTO;
+
+    int halo_depth = strtol(_halo_depth, (char **) NULL, 10);
+
+    return halo_depth < 1 \
+        ? 1 : halo_depth;
+}
+
+/**
+ * Parse the number of generations between checks of the load balance of MPI processes.
+ * 
+ * @param _rebalance    The command line argument.
+ * 
+ * @return    The corresponding number of generations, 0 if it is negative, i.e., never check it.
+ */ 
+int parse_rebalance(char *_rebalance) {
+    int rebalance = strtol(_rebalance, (char **) NULL, 10);
+
+    return rebalance < 0 \
+        ? 0 : rebalance;
+}
+
+/**
+ * Parse how MPI processes exchange ghost rows with their neighbours.
+ * 
+ * @param _exchange    The command line argument.
+ * 
+ * @return    The corresponding exchange in enum Exchanges. Unknown names will show usage and terminate.
+ */ 
+int parse_exchange(char *_exchange) {
+    int exchange;
+
+    for (exchange = 0; exchange < NUM_EXCHANGES; exchange++)
+        if (strcmp(_exchange, EXCHANGE_NAMES[exchange]) == 0)
+            return exchange;
+
+    fprintf(stderr, "\n[*] Unknown exchange of ghost rows: %s\n", _exchange);
+    show_usage();
+
+    return DEFAULT_EXCHANGE;
+}
+
+/**
+ * Parse how rows go on the wire among MPI processes.
+ * 
+ * @param _wire    The command line argument.
+ * 
+ * @return    The corresponding wire format in enum Wires. Unknown names will show usage and terminate.
+ */ 
+int parse_wire(char *_wire) {
+    int wire;
+
+    for (wire = 0; wire < NUM_WIRES; wire++)
+        if (strcmp(_wire, WIRE_NAMES[wire]) == 0)
+            return wire;
+
+    fprintf(stderr, "\n[*] Unknown wire format: %s\n", _wire);
+    show_usage();
+
+    return DEFAULT_WIRE;
+}
+
+/**
+ * Parse how MPI processes write GoL's board to file.
+ * 
+ * @param _output    The command line argument.
+ * 
+ * @return    The corresponding output in enum Outputs. Unknown names will show usage and terminate.
+ */ 
+int parse_output(char *_output) {
+    int output;
+
+    for (output = 0; output < NUM_OUTPUTS; output++)
+        if (strcmp(_output, OUTPUT_NAMES[output]) == 0)
+            return output;
+
+    fprintf(stderr, "\n[*] Unknown output of MPI processes: %s\n", _output);
+    show_usage();
+
+    return DEFAULT_OUTPUT;
+}
+#endif
+
+#ifndef GoL_CUDA
+/**
+ * Parse the name of the evolution engine.
+ * 
+ * @param _engine    The command line argument.
+ * 
+ * @return    The corresponding engine in enum Engines. Unknown names will show usage and terminate.
+ */ 
+int parse_engine(char *_engine) {
+    int engine;
+
+    for (engine = 0; engine < NUM_ENGINES; engine++)
+        if (strcmp(_engine, ENGINE_NAMES[engine]) == 0)
+            return engine;
+
+    fprintf(stderr, "\n[*] Unknown evolution engine: %s\n", _engine);
+    show_usage();
+
+    return DEFAULT_ENGINE;
+}
+
+/**
+ * Parse the number of generations per time block of the temporal engine.
+ * 
+ * @param _time_block    The command line argument.
+ * 
+ * @return    The corresponding number of generations or 1 if the number is smaller than it.
+ */ 
+int parse_time_block(char *_time_block) {
+    int time_block = strtol(_time_block, (char **) NULL, 10);
+
+    return time_block < 1 \
+        ? 1 : time_block;
+}
+
+/**
+ * Parse the number of generations between checkpoints of the board.
+ * 
+ * @param _checkpoint    The command line argument.
+ * 
+ * @return    The corresponding number of generations or 0, i.e., never, if the number is smaller than it.
+ */ 
+int parse_checkpoint(char *_checkpoint) {
+    int checkpoint = strtol(_checkpoint, (char **) NULL, 10);
+
+    return checkpoint < 0 \
+        ? 0 : checkpoint;
+}
+
+/**
+ * Parse the offset of an input pattern within the board, given as R,C, e.g., 100,200 for the 100th row and 200th column.
+ * 
+ * @param _offset    The command line argument.
+ * 
+ * Malformed offsets will show usage and terminate.
+ */ 
+void parse_offset(life_t *life, char *_offset) {
+    if (sscanf(_offset, "%d,%d", &life->pattern_row, &life->pattern_col) != 2) {
+        fprintf(stderr, "\n[*] Malformed offset of the input pattern: %s\n", _offset);
+        show_usage();
+    }
+}
+
+/**
+ * Parse the number of generations between dumps of large boards to the output file.
+ * 
+ * @param _dump    The command line argument.
+ * 
+ * @return    The corresponding number of generations or 0, i.e., only the initial and final ones, if the number is smaller than it.
+ */ 
+int parse_dump(char *_dump) {
+    int dump = strtol(_dump, (char **) NULL, 10);
+
+    return dump < 0 \
+        ? 0 : dump;
+}
+
+/**
+ * Parse the number of dumps queued for the background writer at once.
+ * 
+ * @param _queue_depth    The command line argument.
+ * 
+ * @return    The corresponding number of dumps or 1 if the number is smaller than it.
+ */ 
+int parse_queue_depth(char *_queue_depth) {
+    int queue_depth = strtol(_queue_depth, (char **) NULL, 10);
+
+    return queue_depth < 1 \
+        ? 1 : queue_depth;
+}
+
+/**
+ * Parse what to do when the queue of dumps is full.
+ * 
+ * @param _backpressure    The command line argument.
+ * 
+ * @return    The corresponding policy in enum Backpressures. Unknown names will show usage and terminate.
+ */ 
+int parse_backpressure(char *_backpressure) {
+    int backpressure;
+
+    for (backpressure = 0; backpressure < NUM_BACKPRESSURES; backpressure++)
+        if (strcmp(_backpressure, BACKPRESSURE_NAMES[backpressure]) == 0)
+            return backpressure;
+
+    fprintf(stderr, "\n[*] Unknown backpressure policy: %s\n", _backpressure);
+    show_usage();
+
+    return DEFAULT_BACKPRESSURE;
+}
+#endif
+
 /**
  * Parse command line arguments depending on whether opts are explicitly indicated or not.
  */
@@ -229,15 +534,67 @@ void parse_args(life_t *life, int argc, char **argv) {
                 case 'n':
                     life->nthreads = parse_nthreads(optarg);
                     break;
+                case 'm':
+                    life->team = parse_team(optarg);
+                    break;
                 #endif
                 #ifdef GoL_CUDA
                 case 'b':
                     life->block_size = parse_block_size(optarg);
                     break;
                 #endif
+                #ifdef GoL_MPI
+                case 'g':
+                    parse_proc_grid(life, optarg);
+                    break;
+                case 'd':
+                    life->halo_depth = parse_halo_depth(optarg);
+                    break;
+                case 'w':
+                    life->output = parse_output(optarg);
+                    break;
+                case 'l':
+                    life->rebalance = parse_rebalance(optarg);
+                    break;
+                case 'x':
+                    life->exchange = parse_exchange(optarg);
+                    break;
+                case 'f':
+                    life->wire = parse_wire(optarg);
+                    break;
+                #endif
                 case 'p':
                     life->init_prob = strtod(optarg, (char **) NULL);
                     break;
+                #ifndef GoL_CUDA
+                case 'e':
+                    life->engine = parse_engine(optarg);
+                    break;
+                case 'k':
+                    life->time_block = parse_time_block(optarg);
+                    break;
+                case 'v':
+                    life->checkpoint = parse_checkpoint(optarg);
+                    break;
+                case 'u':
+                    life->restart = optarg;
+                    break;
+                case 'a':
+                    parse_offset(life, optarg);
+                    break;
+                case 'y':
+                    life->exportfile = optarg;
+                    break;
+                case 'j':
+                    life->dump = parse_dump(optarg);
+                    break;
+                case 'q':
+                    life->queue_depth = parse_queue_depth(optarg);
+                    break;
+                case 'z':
+                    life->backpressure = parse_backpressure(optarg);
+                    break;
+                #endif
                 case '?':
                 default:
                     show_usage();
@@ -0,0 +1,341 @@
+#ifndef GoL_UTILS_PATTERN_H
+#define GoL_UTILS_PATTERN_H
+
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <sys/types.h>
+
+// Custom includes
+#include "../globals.h"
+
+/*
+ * Pattern files describe the ALIVE cells of a pattern, which is placed at an offset within GoL's board, rather than the whole board:
+ *
+ * - RLE, i.e., Golly's run length encoded format: a header line "x = <cols>, y = <rows>, rule = B3/S23", preceded by any number of
+ *   '#' comment lines, followed by runs of DEAD cells, 'b', of ALIVE cells, 'o', or of row ends, '$', each of which is optionally
+ *   preceded by its length, up to a final '!'.
+ * - Life 1.06: a "#Life 1.06" header line, followed by the "<col> <row>" coordinates of one ALIVE cell per line.
+ *
+ * Either format is read and written one character or line at a time, in constant memory, whatever the size of the board, and the
+ * pattern wraps around the board's borders as the board does.
+ */
+
+/**
+ * Window of GoL's board that is seeded from a pattern, i.e., either the whole board or the block of an MPI process.
+ */
+typedef struct pattern_window {
+    bool **rows;       // Rows of the window, i.e., rows[i][j] is the cell (row0 + i, col0 + j) of the board
+    int row0, col0;    // Top-left cell of the window within the board
+    int nrows, ncols;  // Number of rows and columns of the window
+    int tot_rows;      // Number of rows of the board
+    int tot_cols;      // Number of columns of the board
+    long off_row;      // Row of the board the top-left cell of the pattern is placed at
+    long off_col;      // Column of the board the top-left cell of the pattern is placed at
+} pattern_window_t;
+
+/**
+ * Mark a cell of the pattern as ALIVE, if it falls within the window once placed at its offset on the board.
+ */
+static inline void place_cell(pattern_window_t *window, long row, long col) {
+    long r = ((window->off_row + row) % window->tot_rows + window->tot_rows) % window->tot_rows - window->row0;
+    long c = ((window->off_col + col) % window->tot_cols + window->tot_cols) % window->tot_cols - window->col0;
+
+    if (r >= 0 && r < window->nrows && c >= 0 && c < window->ncols)
+        window->rows[r][c] = ALIVE;
+}
+
+/**
+ * Tell the format of a pattern file from its first lines.
+ *
+ * @return format    The format of the file, see enum Patterns, i.e., PATTERN_NONE if it is not a pattern or cannot be read.
+ */
+int sniff_pattern(const char *path) {
+    char line[128];
+
+    int format = PATTERN_NONE;
+
+    FILE *file_ptr = fopen(path, "r");
+
+    if (file_ptr == NULL)
+        return PATTERN_NONE;
+
+    if (fgets(line, sizeof(line), file_ptr) != NULL) {
+        if (strncmp(line, "#Life 1.06", 10) == 0) {
+            format = PATTERN_LIFE106;
+        } else {
+            // RLE files start with comment lines, if any, and then with their header
+            while (line[0] == '#' && fgets(line, sizeof(line), file_ptr) != NULL);
+
+            char *start = line + strspn(line, " \t");
+
+            if (start[0] == 'x' && strchr(start, '=') != NULL)
+                format = PATTERN_RLE;
+        }
+    }
+
+    fclose(file_ptr);
+
+    return format;
+}
+
+/**
+ * Tell the format a pattern is exported to from the extension of its file, i.e., Life 1.06 for .lif and .life files, RLE otherwise.
+ */
+int pattern_format(const char *path) {
+    const char *ext = strrchr(path, '.');
+
+    if (ext != NULL && (strcasecmp(ext, ".lif") == 0 || strcasecmp(ext, ".life") == 0))
+        return PATTERN_LIFE106;
+
+    return PATTERN_RLE;
+}
+
+/**
+ * Check that the rule of an RLE header, if any, is GoL's one, B3/S23, in either the B/S or the S/B notation.
+ */
+bool check_rle_rule(const char *header) {
+    const char *rule = strstr(header, "rule");
+
+    if (rule == NULL)
+        return true;
+
+    rule += strlen("rule");
+    rule += strspn(rule, " \t=");
+
+    size_t len = strcspn(rule, " \t,\r\n");
+
+    return (len == 6 && strncasecmp(rule, "B3/S23", len) == 0)
+        || (len == 4 && strncmp(rule, "23/3", len) == 0);
+}
+
+/**
+ * Read an RLE pattern into the window, one character at a time.
+ *
+ * @return valid    Whether the pattern is valid, otherwise the reason is printed to stderr.
+ */
+bool read_rle(FILE *file_ptr, pattern_window_t *window) {
+    int c;
+    long k;
+    long width, height;
+
+    char *line = NULL;
+    size_t buf_size = 0; // Size of the buffer allocated to read the line
+
+    // 1. Skip the comment lines, and read the header
+    do {
+        if (getline(&line, &buf_size, file_ptr) == -1) {
+            fprintf(stderr, "[*] The RLE pattern lacks its header!\n");
+            free(line);
+            return false;
+        }
+    } while (line[0] == '#');
+
+    if (sscanf(line, " x = %ld , y = %ld", &width, &height) != 2 || width < 0 || height < 0) {
+        fprintf(stderr, "[*] The RLE pattern has an invalid header: %s", line);
+        free(line);
+        return false;
+    }
+
+    if (!check_rle_rule(line)) {
+        fprintf(stderr, "[*] The RLE pattern follows another rule than B3/S23: %s", line);
+        free(line);
+        return false;
+    }
+
+    free(line);
+
+    if (width > window->tot_cols || height > window->tot_rows) {
+        fprintf(stderr, "[*] The %ldx%ld RLE pattern does not fit GoL's %dx%d board!\n",
+                height, width, window->tot_rows, window->tot_cols);
+        return false;
+    }
+
+    // 2. Place the runs of ALIVE cells, up to the final '!'
+    long row = 0, col = 0;
+    long count = 0; // Length of the next run, if given
+
+    while ((c = fgetc(file_ptr)) != EOF && c != '!') {
+        if (isdigit(c)) {
+            count = count * 10 + (c - '0');
+            continue;
+        }
+
+        if (isspace(c))
+            continue;
+
+        long n = count > 0 ? count : 1;
+
+        count = 0;
+
+        if (c == '$') {
+            row += n;
+            col  = 0;
+        } else if (c == 'b' || c == '.') {
+            col += n;
+        } else if (isalpha(c)) { // 'o', or any other state of multi-state patterns
+            for (k = 0; k < n; k++)
+                place_cell(window, row, col + k);
+
+            col += n;
+        } else {
+            fprintf(stderr, "[*] The RLE pattern has an invalid character: '%c'\n", c);
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/**
+ * Read a Life 1.06 pattern into the window, one line at a time.
+ *
+ * @return valid    Whether the pattern is valid, otherwise the reason is printed to stderr.
+ */
+bool read_life106(FILE *file_ptr, pattern_window_t *window) {
+    long row, col;
+
+    char line[128];
+
+    while (fgets(line, sizeof(line), file_ptr) != NULL) {
+        if (line[0] == '#' || line[strspn(line, " \t\r\n")] == '\0')
+            continue;
+
+        if (sscanf(line, "%ld %ld", &col, &row) != 2) {
+            fprintf(stderr, "[*] The Life 1.06 pattern has an invalid line: %s", line);
+            return false;
+        }
+
+        place_cell(window, row, col);
+    }
+
+    return true;
+}
+
+/**
+ * Read a pattern file into the window, at its offset within the board.
+ *
+ * @return valid    Whether the pattern is valid, otherwise the reason is printed to stderr.
+ */
+bool read_pattern(const char *path, int format, pattern_window_t *window) {
+    FILE *file_ptr = fopen(path, "r");
+
+    if (file_ptr == NULL) {
+        perror("[*] Failed to open the pattern file.");
+        return false;
+    }
+
+    bool valid = format == PATTERN_RLE \
+            ? read_rle(file_ptr, window)
+            : read_life106(file_ptr, window);
+
+    fclose(file_ptr);
+
+    return valid;
+}
+
+/**
+ * Writer of a pattern file, which is fed GoL's board one row at a time.
+ */
+typedef struct pattern_writer {
+    FILE *out_ptr;   // Pattern file
+    int format;      // Format of the pattern file, see enum Patterns
+    long row;        // # of the next row of the board
+    long row_ends;   // # of row ends yet to be written, as they are left out after the last ALIVE cell, RLE only
+    int line_len;    // # of characters in the current line, RLE only
+} pattern_writer_t;
+
+/**
+ * Open a pattern file for a board of nrows x ncols cells, and write its header.
+ *
+ * @return valid    Whether the file could be opened, otherwise the reason is printed to stderr.
+ */
+bool open_pattern(pattern_writer_t *writer, const char *path, int nrows, int ncols) {
+    if ((writer->out_ptr = fopen(path, "w")) == NULL) {
+        perror("[*] Failed to open the pattern file.");
+        return false;
+    }
+
+    writer->format   = pattern_format(path);
+    writer->row      = 0;
+    writer->row_ends = 0;
+    writer->line_len = 0;
+
+    if (writer->format == PATTERN_RLE)
+        fprintf(writer->out_ptr, "x = %d, y = %d, rule = B3/S23\n", ncols, nrows);
+    else
+        fprintf(writer->out_ptr, "#Life 1.06\n");
+
+    return true;
+}
+
+/**
+ * Write a run of n tags to an RLE file, wrapping lines at RLE_LINE_LENGTH characters.
+ */
+static inline void put_rle_run(pattern_writer_t *writer, long n, char tag) {
+    char run[24];
+
+    int len = n > 1 ? sprintf(run, "%ld%c", n, tag) : sprintf(run, "%c", tag);
+
+    if (writer->line_len + len > RLE_LINE_LENGTH) {
+        fputc('\n', writer->out_ptr);
+        writer->line_len = 0;
+    }
+
+    fputs(run, writer->out_ptr);
+    writer->line_len += len;
+}
+
+/**
+ * Write the next row of the board to a pattern file.
+ */
+void write_pattern_row(pattern_writer_t *writer, const bool *row, int ncols) {
+    int j, k;
+
+    if (writer->format == PATTERN_LIFE106) {
+        for (j = 0; j < ncols; j++)
+            if (row[j] == ALIVE)
+                fprintf(writer->out_ptr, "%d %ld\n", j, writer->row);
+    } else {
+        for (j = 0; j < ncols; j = k) {
+            for (k = j + 1; k < ncols && row[k] == row[j]; k++);
+
+            // DEAD cells at the end of a row are implied
+            if (row[j] == DEAD && k == ncols)
+                break;
+
+            // Row ends are only written before the next ALIVE cell
+            if (writer->row_ends > 0) {
+                put_rle_run(writer, writer->row_ends, '$');
+                writer->row_ends = 0;
+            }
+
+            put_rle_run(writer, k - j, row[j] == ALIVE ? 'o' : 'b');
+        }
+
+        writer->row_ends++;
+    }
+
+    writer->row++;
+}
+
+/**
+ * Terminate a pattern file, and close it.
+ *
+ * @return valid    Whether the file could be written, otherwise the reason is printed to stderr.
+ */
+bool close_pattern(pattern_writer_t *writer) {
+    if (writer->format == PATTERN_RLE)
+        fprintf(writer->out_ptr, "!\n");
+
+    if (fclose(writer->out_ptr) != 0) {
+        perror("[*] Failed to write the pattern file.");
+        return false;
+    }
+
+    return true;
+}
+
+#endif
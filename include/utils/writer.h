@@ -0,0 +1,212 @@
+#ifndef GoL_UTILS_WRITER_H
+#define GoL_UTILS_WRITER_H
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+// Custom includes
+#include "../globals.h"
+
+/*
+ * GoL's board is written to file in FM format through a writer, which is opened once per run and formats whole rows into a large
+ * aligned buffer, DEFAULT_WRITE_BUFFER bytes long, that goes to the file with a single write() call whenever it is full, rather
+ * than through one fprintf() call per cell.
+ */
+
+/**
+ * Format n cells as 'X' for ALIVE cells and ' ' for DEAD cells, 8 at a time: as bools are either 0 or 1, a word of 8 cells
+ * times ('X' - ' ') plus 8 spaces yields their 8 characters, with no carries from one byte to the next.
+ */
+static inline void format_cells(const bool *cells, int n, char *chars) {
+    int j;
+
+    const uint64_t spaces = 0x2020202020202020ULL; // 8 x ' '
+
+    for (j = 0; j + 8 <= n; j += 8) {
+        uint64_t word;
+
+        memcpy(&word, cells + j, sizeof(uint64_t));
+
+        word = word * ('X' - ' ') + spaces;
+
+        memcpy(chars + j, &word, sizeof(uint64_t));
+    }
+
+    for (; j < n; j++)
+        chars[j] = cells[j] == ALIVE ? 'X' : ' ';
+}
+
+/**
+ * A buffered writer of the output file, kept open for the whole run.
+ */
+typedef struct writer {
+    int fd;           // Output file, or -1 if not open yet
+    char *buffer;     // Buffer of DEFAULT_WRITE_BUFFER bytes, aligned to DEFAULT_ALIGNMENT bytes
+    size_t len;       // # of bytes in the buffer
+    double bytes;     // # of bytes written to file
+    double time;      // Time spent formatting and writing GoL's board, in ms
+} writer_t;
+
+/**
+ * Initialize a writer, whose file is only opened once the board is first written to it.
+ */
+void init_writer(writer_t *writer) {
+    writer->fd     = -1;
+    writer->buffer = NULL;
+    writer->len    = 0;
+    writer->bytes  = 0.;
+    writer->time   = 0.;
+}
+
+/**
+ * Write the buffer to file, with as few write() calls as the kernel allows.
+ */
+void flush_writer(writer_t *writer) {
+    size_t done = 0;
+
+    while (done < writer->len) {
+        ssize_t n = write(writer->fd, writer->buffer + done, writer->len - done);
+
+        if (n == -1 && errno == EINTR)
+            continue;
+
+        if (n == -1) {
+            perror("[*] Failed to write to the output file.");
+            exit(EXIT_FAILURE);
+        }
+
+        done += n;
+    }
+
+    writer->bytes += writer->len;
+    writer->len    = 0;
+}
+
+/**
+ * Close the writer's file, if open, and free its buffer. Its counters are kept, to be logged.
+ */
+void close_writer(writer_t *writer) {
+    if (writer->fd != -1) {
+        flush_writer(writer);
+        close(writer->fd);
+    }
+
+    free(writer->buffer);
+
+    writer->fd     = -1;
+    writer->buffer = NULL;
+}
+
+/**
+ * Open the writer's file, overwriting it, or reopen it if already open.
+ */
+void open_writer(writer_t *writer, const char *path) {
+    if (writer->fd != -1) {
+        flush_writer(writer);
+        close(writer->fd);
+    }
+
+    if ((writer->fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644)) == -1) {
+        perror("[*] Failed to open the output file.");
+        exit(EXIT_FAILURE);
+    }
+
+    if (writer->buffer == NULL
+            && posix_memalign((void **) &writer->buffer, DEFAULT_ALIGNMENT, DEFAULT_WRITE_BUFFER) != 0) {
+        perror("[*] Failed to allocate the output buffer.");
+        exit(EXIT_FAILURE);
+    }
+}
+
+/**
+ * Append len bytes to the writer.
+ */
+void write_bytes(writer_t *writer, const char *data, size_t len) {
+    while (len > 0) {
+        if (writer->len == (size_t) DEFAULT_WRITE_BUFFER)
+            flush_writer(writer);
+
+        size_t n = DEFAULT_WRITE_BUFFER - writer->len;
+
+        if (n > len)
+            n = len;
+
+        memcpy(writer->buffer + writer->len, data, n);
+
+        writer->len += n;
+        data        += n;
+        len         -= n;
+    }
+}
+
+/**
+ * Append a row of GoL's board to the writer, formatted straight into its buffer via format_cells(), and followed by a newline.
+ */
+void write_row(writer_t *writer, const bool *row, int ncols) {
+    while (ncols > 0) {
+        if (writer->len == (size_t) DEFAULT_WRITE_BUFFER)
+            flush_writer(writer);
+
+        int n = DEFAULT_WRITE_BUFFER - writer->len;
+
+        if (n > ncols)
+            n = ncols;
+
+        format_cells(row, n, writer->buffer + writer->len);
+
+        writer->len += n;
+        row         += n;
+        ncols       -= n;
+    }
+
+    write_bytes(writer, "\n", 1);
+}
+
+/**
+ * Start printing a board of nrows x ncols cells in FM format, whose rows are then appended via write_row(). Unless appended to the
+ * previous boards, the output file is overwritten and the board dimensions are printed only once.
+ */
+void begin_board(writer_t *writer, const char *path, int nrows, int ncols, bool append) {
+    if (!append) {
+        char header[32];
+
+        open_writer(writer, path);
+        write_bytes(writer, header, sprintf(header, "%d %d\n", nrows, ncols));
+    }
+}
+
+/**
+ * Terminate the board with the separator, so that the whole board is on file.
+ */
+void end_board(writer_t *writer) {
+    const char *separator = "****************************************************************************************************\n";
+
+    write_bytes(writer, separator, strlen(separator));
+    flush_writer(writer);
+}
+
+/**
+ * Evaluate the output bandwidth of the writer, i.e., the bytes written per time spent formatting and writing them.
+ *
+ * @return bandwidth    The output bandwidth in MB/s, or 0 if nothing was written.
+ */
+double writer_bandwidth(writer_t writer) {
+    return writer.time > 0. \
+            ? writer.bytes / 1e6 / (writer.time / 1e3) : 0.;
+}
+
+/**
+ * Print to console how much of GoL's board the writer wrote to file, and its output bandwidth, if it wrote anything.
+ */
+void report_writer(writer_t writer) {
+    if (writer.bytes > 0.)
+        printf("Wrote %.2f MB of GoL's board to file - ETA: %.5f ms, %.2f MB/s\n",
+                writer.bytes / 1e6, writer.time, writer_bandwidth(writer));
+}
+
+#endif
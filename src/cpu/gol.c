@@ -1,5 +1,6 @@
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <sys/time.h>
 
 // Custom includes
@@ -9,28 +10,32 @@
  * Initialize all variables and structures required by GoL evolution.
  */
 void initialize(life_t *life) {
-    // 1. Initialize the random seed
-    srand(life->seed);
-
-    // 2. Check if an input file was specified in the args
+    // 1. Check if an input file was specified in the args
     // and, in that case, update ncols and nrows.
     //
     // Use defaults, if no file is present.
     FILE *input_ptr = set_grid_dimens_from_file(life);
 
-    // 3. Allocate memory for the grid
+    // 2. Allocate memory for the grid
     malloc_grid(life);
 
-    // 4. Initialize the grid with DEAD cells
+    // 3. Initialize the grid with DEAD cells
     init_empty_grid(life);
 
-    // 5. Initialize the grid with ALIVE cells...
-    if (input_ptr != NULL) { // ...from file, if present...
+    // 4. Initialize the grid with ALIVE cells...
+    if (life->board != NULL) { // ...from a binary board, i.e., the checkpoint to restart from or the input file, if any...
+        init_from_board(life);
+    } else if (life->pattern != PATTERN_NONE) { // ...from an input pattern, if any...
+        init_from_pattern(life);
+    } else if (input_ptr != NULL) { // ...from file, if present...
         init_from_file(life, input_ptr);
     } else {  // ...or randomly, otherwise.
         init_random(life);
     }
 
+    // 5. Initialize the data structures of the evolution engine
+    engine_init(life);
+
     #ifdef GoL_DEBUG
     debug(*life);
     usleep(1000000);
@@ -38,17 +43,25 @@ void initialize(life_t *life) {
 }
 
 /**
- * Perform GoL evolution for a given amount of generations.
+ * Perform GoL evolution for a given amount of generations, from the checkpoint to restart from if any, and write a checkpoint every so
+ * many generations, if requested. Large boards are dumped to file in the background, at the start, every so many generations, if
+ * requested, and at the end.
  * 
  * @return tot_gene_time    The total time devolved to GoL evolution
  */
 double game(life_t *life) {
     int x, y, t;
+    int steps; // # of generations evolved at once
 
     struct timeval gstart, gend;
+
+    checkpoint_t ckpt;
+    snapshots_t snaps;
     
     // Initialize the whole GoL grid
     initialize(life);
+    init_checkpoint(&ckpt, *life);
+    init_snapshots(&snaps, *life);
 
     int ncols = life->ncols;
     int nrows = life->nrows;
@@ -56,14 +69,36 @@ double game(life_t *life) {
     double tot_gene_time = 0.;
     double cur_gene_time = 0.;
 
-    display(*life, false);
+    save_snapshot(&snaps, life, false, true);
+
+    #if (defined _OPENMP) && !(defined GoL_DEBUG)
+    // Large boards, which are displayed only at the end, can be evolved by a persistent team of threads
+    if (life->team == TEAM_PERSISTENT
+            && team_supports(life->engine)
+            && is_big(*life)) {
+        tot_gene_time = evolve_team(life, &ckpt, &snaps);
+
+        save_snapshot(&snaps, life, true, true);
+
+        free_checkpoint(&ckpt);
+        free_snapshots(&snaps);
+
+        printf("\nEvolved GoL's grid for %d generations - ETA: %.5f ms\n",
+            life->timesteps, tot_gene_time);
+
+        return tot_gene_time;
+    }
+    #endif
 
-    for(t = 0; t < life->timesteps; t++) { 
+    for(t = life->generation; t < life->timesteps; t += steps) {
         // 1. Track the start time
         gettimeofday(&gstart, NULL);
         
-        // 2. Evolve the current generation
-        evolve(life);
+        // 2. Evolve the current generation, or more at once if the engine allows for it, up to the next checkpoint or dump,
+        // but for small boards, which are displayed at every generation
+        int max_steps = is_big(*life) ? life->timesteps - t : 1;
+
+        steps = engine_evolve(life, snapshot_steps(&snaps, t, checkpoint_steps(&ckpt, t, max_steps)));
         
         // 3. Track the end time
         gettimeofday(&gend, NULL);
@@ -72,25 +107,42 @@ double game(life_t *life) {
         tot_gene_time += cur_gene_time;
 
         if (is_big(*life)) {
-            printf("Generation #%d took %.5f ms\n", t, cur_gene_time);  
-
-            // If the GoL grid is large, print it (to file)
-            // only at the end of the last generation
-            if (t == life->timesteps - 1) {
-                display(*life, true);
+            if (steps == 1)
+                printf("Generation #%d took %.5f ms\n", t, cur_gene_time);
+            else
+                printf("Generations #%d-#%d took %.5f ms\n", t, t + steps - 1, cur_gene_time);
+
+            // If the GoL grid is large, dump it (to file) in the background
+            // only every so many generations and at the end of the last one
+            if (t + steps == life->timesteps || is_snapshot(&snaps, t + steps)) {
+                engine_sync(life);
+                save_snapshot(&snaps, life, true, t + steps == life->timesteps);
             }
         } else {
+            engine_sync(life);
             display(*life, true);
         }
 
         #ifdef GoL_DEBUG
+        engine_sync(life);
         get_grid_status(*life);
         #endif
+
+        // 4. Write a checkpoint in the background, every so many generations
+        if (is_checkpoint(&ckpt, t + steps)) {
+            engine_sync(life);
+            save_checkpoint(&ckpt, life, t + steps);
+        }
     }
 
+    free_checkpoint(&ckpt);
+    free_snapshots(&snaps);
+
     printf("\nEvolved GoL's grid for %d generations - ETA: %.5f ms\n",
         life->timesteps, tot_gene_time);
 
+    engine_report(*life);
+
     return tot_gene_time;
 }
 
@@ -145,18 +197,12 @@ void evolve(life_t *life) {
 }
 
 void cleanup(life_t *life) {
-    int i;
+    engine_cleanup(life);
+    close_writer(life->writer);
 
-    #ifdef _OPENMP
-    #pragma omp parallel for
-    #endif
-    for (i = 0; i < life->nrows; i++) {
-        free(life->grid[i]);
-        free(life->next_grid[i]);
-    }
-
-    free(life->grid);
-    free(life->next_grid);
+    // Account for the top ghost row
+    free_frame(life->grid - 1, 1);
+    free_frame(life->next_grid - 1, 1);
 }
 
 /************************************
@@ -167,14 +213,18 @@ int main(int argc, char **argv) {
     struct timeval start, end;
     double cum_gene_time, elapsed_prog_wtime;
 
-    int nprocs = 1; // # of running processes
-    life_t life;    // GoL's main data structure
+    int nprocs = 1;  // # of running processes
+    life_t life;     // GoL's main data structure
+    writer_t writer; // Writer of the output file, which outlives GoL's board to be logged
 
     gettimeofday(&start, NULL);
 
     // 1. Initialize vars from args
     parse_args(&life, argc, argv);
 
+    init_writer(&writer);
+    life.writer = &writer;
+
     #ifdef _OPENMP
     omp_set_num_threads(life.nthreads);
     #endif
@@ -182,11 +232,6 @@ int main(int argc, char **argv) {
     FILE *input_ptr = set_grid_dimens_from_file(&life);
 
     #ifdef GoL_MPI /* GoL parallel with MPI */
-    int rows_per_process;
-
-    int from; // Boundaries of the slices of data
-    int to;   // each process will take care of
-
     // 2. Initialize MPI environment
     int status = MPI_Init(&argc, &argv);
 
@@ -209,28 +254,24 @@ int main(int argc, char **argv) {
                            // launch GoL's parallel evolution...
         MPI_Barrier(MPI_COMM_WORLD);
 
-        // 4.a Calculate the number of rows
-        // that each process will handle 
-        rows_per_process = (int) life.nrows/chunk.size;
-        chunk.displacement = life.nrows % chunk.size;
+        // 4.a Arrange the processes in a 2D grid, and identify
+        // the block of rows and columns each process will handle
+        init_chunk_grid(&chunk, life);
 
-        // 4.b Identify the starting row of each process
-        from = chunk.rank * rows_per_process;
+        // 4.b Fall back to the naive engine if the selected one cannot evolve chunks
+        chunk.engine = life.engine;
+        chunk.output = life.output;
 
-        // 4.c Identify the last row of each process.
-        if (chunk.rank == chunk.size - 1) { // Last process will keep all remaining rows
-            to = life.nrows - 1;
-            chunk.nrows = life.nrows - from;
-        } else {
-            to = (chunk.rank + 1) * rows_per_process - 1;
-            chunk.nrows = rows_per_process;
-        }
+        if (!engine_supports_chunk(chunk.engine)) {
+            if (chunk.rank == 0)
+                fprintf(stderr, "[*] The %s engine does not support MPI, falling back to the %s one...\n",
+                        ENGINE_NAMES[chunk.engine], ENGINE_NAMES[ENGINE_NAIVE]);
 
-        chunk.ncols = life.ncols; // Data is split on rows; hence all processes
-                                  // will have the same # of columns
+            chunk.engine = ENGINE_NAIVE;
+        }
 
         initialize_chunk(&chunk, life,
-                input_ptr, from, to);
+                input_ptr);
 
         double tot_gtime = game_chunk(&chunk, life);
 
@@ -238,6 +279,10 @@ int main(int argc, char **argv) {
             cum_gene_time = tot_gtime;
         }
 
+        // Export the final board as a pattern, if requested
+        if (life.exportfile != NULL)
+            export_chunk_pattern(&chunk, life.exportfile);
+
         MPI_Barrier(MPI_COMM_WORLD);
 
         cleanup_chunk(&chunk);
@@ -248,7 +293,21 @@ int main(int argc, char **argv) {
         }
     } else { // ...else fall back to the sequential procedure
         cum_gene_time = game(&life);
+
+        if (life.exportfile != NULL)
+            export_pattern(life);
+
         cleanup(&life);
+        report_writer(writer);
+
+        // A single process spends all its time computing, and writes all of the output
+        memset(&chunk.timings, 0, sizeof(timings_t));
+
+        chunk.writer = writer;
+
+        chunk.timings.min[PHASE_COMPUTE] = cum_gene_time;
+        chunk.timings.avg[PHASE_COMPUTE] = cum_gene_time;
+        chunk.timings.max[PHASE_COMPUTE] = cum_gene_time;
 
         gettimeofday(&end, NULL);
         elapsed_prog_wtime = elapsed_wtime(start, end);
@@ -262,7 +321,13 @@ int main(int argc, char **argv) {
     }
     #else /* GoL sequential */
     cum_gene_time = game(&life);
+
+    // Export the final board as a pattern, if requested
+    if (life.exportfile != NULL)
+        export_pattern(life);
+
     cleanup(&life);
+    report_writer(writer);
 
     gettimeofday(&end, NULL);
     elapsed_prog_wtime = elapsed_wtime(start, end);
@@ -278,8 +343,13 @@ int main(int argc, char **argv) {
     #endif
     FILE *log_ptr = init_log_file(life, nprocs);
 
+    #ifdef GoL_MPI
     log_data(log_ptr, life.timesteps, cum_gene_time,
-            elapsed_prog_wtime);
+            elapsed_prog_wtime, chunk.timings, chunk.writer);
+    #else
+    log_data(log_ptr, life.timesteps, cum_gene_time,
+            elapsed_prog_wtime, writer);
+    #endif
 
     fflush(log_ptr);
     fclose(log_ptr);
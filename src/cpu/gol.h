@@ -58,15 +58,98 @@ void get_grid_status(life_t life) {
     usleep(320000);
 }
 
+#include "../../include/engine/engine.h"
+
 #ifdef GoL_MPI
 #include "../../include/chunk/init.h"
 
+/**
+ * Pick the depth of the halo of a chunk from a probe of the network and of the evolution engine, once the chunk has been initialized
+ * with a single ghost row on either side.
+ *
+ * Exchanging k ghost rows every k generations costs a latency every k generations, and the shrinking valid region costs k - 1
+ * redundant rows per generation on average, whereas the bandwidth does not depend on k, as the same rows are sent either way.
+ * Thus, the best k is the one that minimizes latency / k + (k - 1) * row_time, with both terms averaged across all processes.
+ *
+ * @return ghost    The depth of the halo, no deeper than the slimmest block.
+ */
+int probe_halo_depth(chunk_t *chunk) {
+    int r;
+
+    int nrows = chunk->nrows;
+    int ncols = chunk->ncols;
+
+    int up   = chunk->neighbs[0][1];
+    int down = chunk->neighbs[2][1];
+
+    double probe[3]; // Latency, time per cell on the wire and time per row evolved, in seconds
+    double start;
+
+    // 1. Exchange a single cell with both neighbours, to measure the latency...
+    MPI_Barrier(chunk->comm);
+    start = MPI_Wtime();
+
+    for (r = 0; r < DEFAULT_PROBE_REPS; r++)
+        MPI_Sendrecv(chunk->slice[1], 1, MPI_C_BOOL, up, PROBE,
+                     chunk->slice[nrows + 1], 1, MPI_C_BOOL, down, PROBE,
+                     chunk->comm, MPI_STATUS_IGNORE);
+
+    probe[0] = (MPI_Wtime() - start) / DEFAULT_PROBE_REPS;
+
+    // 2. ...and a whole row, to measure the bandwidth
+    MPI_Barrier(chunk->comm);
+    start = MPI_Wtime();
+
+    for (r = 0; r < DEFAULT_PROBE_REPS; r++)
+        MPI_Sendrecv(chunk->slice[1], ncols, MPI_C_BOOL, up, PROBE,
+                     chunk->slice[nrows + 1], ncols, MPI_C_BOOL, down, PROBE,
+                     chunk->comm, MPI_STATUS_IGNORE);
+
+    probe[1] = (MPI_Wtime() - start) / DEFAULT_PROBE_REPS - probe[0];
+    probe[1] = probe[1] > 0. ? probe[1] / ncols : 0.;
+
+    // 3. Evolve at least DEFAULT_PROBE_REPS rows into the next slice, which is overwritten at the first generation anyway
+    int nreps = (DEFAULT_PROBE_REPS + nrows - 1) / nrows;
+
+    wrap_frame_cols(chunk->slice, 0, nrows + 2, ncols, 1);
+
+    start = MPI_Wtime();
+
+    for (r = 0; r < nreps; r++)
+        engine_evolve_chunk(chunk, 1, nrows + 1);
+
+    probe[2] = (MPI_Wtime() - start) / ((double) nreps * nrows);
+
+    MPI_Allreduce(MPI_IN_PLACE, probe, 3, MPI_DOUBLE, MPI_SUM, chunk->comm);
+
+    for (r = 0; r < 3; r++)
+        probe[r] /= chunk->size;
+
+    // 4. Deepen the halo as long as the latency saved outweighs the rows added, i.e., k (k + 1) < latency / row_time
+    int ghost    = 1;
+    int min_rows = chunk_start(chunk->tot_rows, chunk->dims[0], 1);
+
+    while (ghost < min_rows
+            && (double) ghost * (ghost + 1) * probe[2] < probe[0])
+        ghost++;
+
+    if (chunk->rank == 0)
+        printf("Exchanging %d ghost rows at once - latency: %.2f us, bandwidth: %.2f MB/s, evolution: %.2f us per row\n\n",
+                ghost, probe[0] * 1e6, probe[1] > 0. ? 1e-6 / probe[1] : 0., probe[2] * 1e6);
+
+    return ghost;
+}
+
 /**
  * Initialize all variables and structures required by a single GoL chunk.
  */
 void initialize_chunk(chunk_t *chunk, life_t life,
-        FILE *input_ptr, int from, int to) {
-    srand(life.seed);
+        FILE *input_ptr) {
+    // The depth of the halo is picked once the chunk can be evolved
+    bool probe = chunk->ghost == HALO_AUTO;
+
+    if (probe)
+        chunk->ghost = 1;
 
     // 1. Allocate memory for the chunk
     malloc_chunk(chunk);
@@ -75,128 +158,489 @@ void initialize_chunk(chunk_t *chunk, life_t life,
     init_empty_chunk(chunk);
     
     // 3. Initialize the chunk with ALIVE cells...
-    if (input_ptr != NULL) { // ...from file, if present...
-        init_chunk_from_file(chunk, life.nrows, life.ncols,
-                input_ptr, from, to);
+    if (life.board != NULL) { // ...from a binary board, i.e., the checkpoint to restart from or the input file, if any...
+        init_chunk_from_board(chunk, life.board);
+    } else if (life.pattern != PATTERN_NONE) { // ...from an input pattern, if any...
+        init_chunk_from_pattern(chunk, life);
+    } else if (input_ptr != NULL) { // ...from file, if present...
+        init_chunk_from_file(chunk, life.infile,
+                input_ptr);
     } else {  // ...or randomly, otherwise.
-        init_random_chunk(chunk, life, from, to);
+        init_random_chunk(chunk, life);
     }
 
+    // 4. Initialize the data structures of the evolution engine
+    engine_init_chunk(chunk);
+
+    // 5. Pick the depth of the halo, if requested, on a grid of a single column
+    if (probe && chunk->dims[1] == 1)
+        set_chunk_ghost(chunk, probe_halo_depth(chunk));
+
+    // 6. Let the neighbours on the same node copy the borders, if they share memory
+    if (chunk->exchange == EXCHANGE_SHARED)
+        publish_shared_chunk(chunk);
+
     #ifdef GoL_DEBUG
     debug_chunk(*chunk);
     usleep(1000000);
     #endif
 }
 
+/**
+ * Post the exchange of the border of a chunk at (di, dj) from its centre with the neighbour process in that direction, with di, dj
+ * in {-1, 0, 1}: the border is sent to the neighbour, and the neighbour's opposite border is received into the ghost cells at (di, dj).
+ * Borders along the rows are as deep as the halo, whereas columns and corners, which are only exchanged on 2D grids, are 1 cell thick.
+ * With WIRE_PACKED, borders along the rows are packed before they are sent, and ghost rows land in the slice via unpack_halo().
+ * 
+ * @param requests    The two requests of the receive and the send, in this order.
+ */
+void post_halo(chunk_t *chunk, int di, int dj, MPI_Request *requests) {
+    int nrows = chunk->nrows;
+    int ncols = chunk->ncols;
+    int ghost = chunk->ghost;
+
+    int neighb = chunk->neighbs[di + 1][dj + 1];
+
+    // Ghost cells and border cells at (di, dj), where the bottom border starts ghost rows above the bottom ghost rows
+    bool *halo   = &chunk->slice[di < 0 ? 0 : di > 0 ? nrows + ghost : ghost][dj < 0 ? -1 : dj > 0 ? ncols : 0];
+    bool *border = &chunk->slice[di > 0 ? nrows + ghost - (dj == 0 ? ghost : 1) : ghost][dj > 0 ? ncols - 1 : 0];
+
+    if (dj == 0 && chunk->wire == WIRE_PACKED) {
+        int side  = di > 0;
+        int count = pack_rows(border, chunk->slice[1] - chunk->slice[0], ghost, ncols, chunk->wire_send[side]);
+
+        MPI_Irecv(chunk->wire_recv[side], (int) wire_words(ghost, ncols), MPI_UINT64_T, neighb, (1 - di) * 3 + 1,
+                  chunk->comm, &requests[0]);
+        MPI_Isend(chunk->wire_send[side], count, MPI_UINT64_T, neighb, (di + 1) * 3 + 1,
+                  chunk->comm, &requests[1]);
+        return;
+    }
+
+    // Rows are strided as well as columns, corners are single cells
+    MPI_Datatype type = (dj == 0) ? chunk->halo_type
+            : (di == 0) ? chunk->col_type : MPI_C_BOOL;
+
+    MPI_Irecv(halo, 1, type, neighb, (1 - di) * 3 + 1 - dj,
+              chunk->comm, &requests[0]);
+    MPI_Isend(border, 1, type, neighb, (di + 1) * 3 + dj + 1,
+              chunk->comm, &requests[1]);
+}
+
+/**
+ * Unpack the ghost rows of a chunk at di from its centre, with di in {-1, 1}, once they have arrived on the wire with WIRE_PACKED.
+ */
+void unpack_halo(chunk_t *chunk, int di) {
+    int ghost = chunk->ghost;
+
+    bool *halo = chunk->slice[di < 0 ? 0 : chunk->nrows + ghost];
+
+    unpack_rows(chunk->wire_recv[di > 0], halo, chunk->slice[1] - chunk->slice[0],
+                ghost, chunk->ncols);
+}
+
+/**
+ * Stop the clock of the current phase of GoL evolution, and restart it for the next one.
+ *
+ * @return elapsed    The time elapsed since the clock was last restarted, in ms.
+ */
+double lap(double *clock) {
+    double now = MPI_Wtime();
+    double elapsed = (now - *clock) * 1000.;
+
+    *clock = now;
+
+    return elapsed;
+}
+
+/**
+ * Reduce the phase times of all processes to their min, avg and max onto rank 0, and print them together with their load imbalance.
+ */
+void reduce_timings(chunk_t *chunk, double *phase_times) {
+    int p;
+
+    timings_t *timings = &chunk->timings;
+
+    MPI_Reduce(phase_times, timings->min, NUM_PHASES, MPI_DOUBLE, MPI_MIN, 0, chunk->comm);
+    MPI_Reduce(phase_times, timings->avg, NUM_PHASES, MPI_DOUBLE, MPI_SUM, 0, chunk->comm);
+    MPI_Reduce(phase_times, timings->max, NUM_PHASES, MPI_DOUBLE, MPI_MAX, 0, chunk->comm);
+
+    if (chunk->rank != 0)
+        return;
+
+    for (p = 0; p < NUM_PHASES; p++) {
+        timings->avg[p] /= chunk->size;
+
+        printf("%-7s time across %d processes - min/avg/max: %.5f/%.5f/%.5f ms, imbalance: %.2f%%\n",
+                PHASE_NAMES[p], chunk->size, timings->min[p], timings->avg[p], timings->max[p],
+                imbalance(*timings, p));
+    }
+}
+
+/**
+ * Reduce the bytes that all processes wrote to the output file to their sum, and the time they spent writing them to its max, onto
+ * rank 0, and print them together with the output bandwidth.
+ */
+void reduce_writer(chunk_t *chunk) {
+    writer_t *writer = &chunk->writer;
+
+    if (chunk->rank == 0) {
+        MPI_Reduce(MPI_IN_PLACE, &writer->bytes, 1, MPI_DOUBLE, MPI_SUM, 0, chunk->comm);
+        MPI_Reduce(MPI_IN_PLACE, &writer->time,  1, MPI_DOUBLE, MPI_MAX, 0, chunk->comm);
+
+        report_writer(*writer);
+    } else {
+        MPI_Reduce(&writer->bytes, NULL, 1, MPI_DOUBLE, MPI_SUM, 0, chunk->comm);
+        MPI_Reduce(&writer->time,  NULL, 1, MPI_DOUBLE, MPI_MAX, 0, chunk->comm);
+    }
+}
+
+/**
+ * Move rows from the slower processes to the faster ones, if the load imbalance of the compute phase since the last check exceeds
+ * DEFAULT_REBALANCE_THRESHOLD, on a grid of a single column.
+ *
+ * All processes gather the compute times of all bands, and assume that the cost of a row is even within each band, so that they
+ * agree on new bands of equal cost without any further message. Every band keeps at least as many rows as the halo is deep.
+ *
+ * @param cost          The compute time of the calling process since the last check, in ms.
+ * @param generation    The # of the next generation, only to report it.
+ *
+ * @return moved    Whether any row moved from one process to another.
+ */
+bool rebalance_chunk(chunk_t *chunk, double cost, int generation) {
+    int pr;
+
+    int nbands = chunk->dims[0];
+    int ghost  = chunk->ghost;
+
+    int *old_starts = chunk->row_starts;
+
+    double *costs   = (double *) malloc(sizeof(double) * nbands);
+    int *row_starts = (int *) malloc(sizeof(int) * (nbands + 1));
+
+    if (costs == NULL || row_starts == NULL) {
+        perror("[*] Failed to allocate the load balance of processes.");
+        MPI_Abort(MPI_COMM_WORLD, 1);
+    }
+
+    // 1. Gather the compute times of all bands, in the same order as their ranks on a grid of a single column
+    MPI_Allgather(&cost, 1, MPI_DOUBLE, costs, 1, MPI_DOUBLE, chunk->comm);
+
+    double tot_cost = 0., max_cost = 0.;
+
+    for (pr = 0; pr < nbands; pr++) {
+        tot_cost += costs[pr];
+        max_cost  = costs[pr] > max_cost ? costs[pr] : max_cost;
+    }
+
+    double imbalance = tot_cost > 0. \
+            ? (max_cost / (tot_cost / nbands) - 1.) * 100. : 0.;
+
+    if (imbalance <= DEFAULT_REBALANCE_THRESHOLD) {
+        free(costs);
+        free(row_starts);
+
+        return false;
+    }
+
+    // 2. Split the cumulative cost of the rows into bands of equal cost...
+    int b = 1;
+    double cum_cost = 0.;
+
+    row_starts[0]      = 0;
+    row_starts[nbands] = chunk->tot_rows;
+
+    for (pr = 0; pr < nbands && b < nbands; pr++) {
+        int rows = old_starts[pr + 1] - old_starts[pr];
+
+        while (b < nbands && cum_cost + costs[pr] >= tot_cost * b / nbands) {
+            double frac = costs[pr] > 0. ? (tot_cost * b / nbands - cum_cost) / costs[pr] : 0.;
+
+            row_starts[b++] = old_starts[pr] + (int) (frac * rows + .5);
+        }
+
+        cum_cost += costs[pr];
+    }
+
+    while (b < nbands)
+        row_starts[b++] = chunk->tot_rows;
+
+    // 3. ...which are at least ghost rows tall, and leave at least ghost rows to each of the bands below
+    bool moved = false;
+
+    for (b = 1; b < nbands; b++) {
+        int lo = row_starts[b - 1] + ghost;
+        int hi = chunk->tot_rows - (nbands - b) * ghost;
+
+        row_starts[b] = row_starts[b] < lo ? lo : row_starts[b] > hi ? hi : row_starts[b];
+
+        if (row_starts[b] != old_starts[b])
+            moved = true;
+    }
+
+    if (moved) {
+        move_chunk_rows(chunk, row_starts);
+
+        if (chunk->rank == 0)
+            printf("Rebalanced GoL's rows before generation #%d - compute imbalance: %.2f%%\n",
+                    generation, imbalance);
+    }
+
+    free(costs);
+    free(row_starts);
+
+    return moved;
+}
+
 /**
  * Perform GoL evolution on a single chunk for a given amount of generations.
+ *
+ * With a halo k rows deep, ghost rows are exchanged once every k generations, and the chunk and its ghost rows are evolved for k
+ * generations on their own. At the g-th generation, only the rows that are g rows or more away from the outermost ghost rows are
+ * evolved, as the others miss some neighbours: thus, the valid region shrinks by one row per side and generation, and after k
+ * generations it matches the chunk. That is, k-fold fewer messages for k - 1 redundant rows per generation on average.
+ *
+ * Processes never synchronize but through their neighbours' messages, and each of them times its own compute, comm and wait phases,
+ * which are reduced across processes only once the evolution is over. The per-generation timings are those of rank 0. If requested,
+ * processes check their load balance every so many generations, and move rows from the slower ones to the faster ones. Likewise,
+ * they start from the checkpoint to restart from, if any, and write a checkpoint every so many generations.
  * 
  * @return tot_gene_time    The total time devolved to GoL evolution
  */
 double game_chunk(chunk_t *chunk, life_t life) {
-    int i;
-    MPI_Status status;
+    int g, i;
+    MPI_Request requests[16];
 
     int timesteps = life.timesteps;
-    int tot_rows  = life.nrows;
     char *outfile = life.outfile;
 
+    int ncols = chunk->ncols;
+    int ghost = chunk->ghost;
+
     bool big = is_big(life);
 
-    struct timeval gstart, gend;
+    // Whether the grid of processes has a single column, thus ghost columns wrap around the chunk's own rows
+    bool strips = chunk->dims[1] == 1;
+
+    // Whether ghost rows are copied from the neighbours on the same node, which implies strips
+    bool shared = chunk->exchange == EXCHANGE_SHARED;
+
+    int steps; // # of generations evolved per exchange of the halo
+
+    int balanced_at = life.generation; // # of the generation of the last check of the load balance
+    double balanced_cost = 0.;         // Compute time at the last check of the load balance
+
+    double gstart, clock;
+
+    double phase_times[NUM_PHASES] = {0.}; // Time spent by this process in each phase, see enum Phases
 
     double cur_gene_time = 0.0;
     double tot_gene_time = 0.0;
 
-    display_chunk(chunk, big, tot_rows,
-            outfile, false);
+    display_chunk(chunk, big, outfile, false);
 
-    /*
-     * Only one process (rank 0) will be allowed to track evolution timings.
-     * 
-     * TODO: Track the average evolution timings across all processes.
-     */
-    for (i = 0; i < timesteps; i++) {
-        MPI_Barrier(MPI_COMM_WORLD);
+    for (i = life.generation; i < timesteps; i += steps) {
+        steps = timesteps - i < ghost ? timesteps - i : ghost;
 
-        if (chunk->rank == 0)
-            // Track the start time
-            gettimeofday(&gstart, NULL);
+        // Blocks of generations do not skip checkpoints, nor dumps
+        if (chunk->checkpoint > 0 && chunk->checkpoint - i % chunk->checkpoint < steps)
+            steps = chunk->checkpoint - i % chunk->checkpoint;
+
+        if (chunk->dump > 0 && chunk->dump - i % chunk->dump < steps)
+            steps = chunk->dump - i % chunk->dump;
+
+        // Small boards are displayed at every generation
+        if (!big)
+            steps = 1;
+
+        // The rows of the chunk change as it is rebalanced
+        int nrows    = chunk->nrows;
+        int tot_rows = nrows + 2*ghost; // # of rows of the slice, ghost rows included
+
+        // Interior rows, which need no ghost rows at the 1st generation of the halo: (ghost + 1, ..., ghost + nrows - 1)
+        int inner_from = ghost + 1;
+        int inner_to   = ghost + nrows - 1 > inner_from ? ghost + nrows - 1 : inner_from;
+
+        // Track the start time
+        gstart = clock = MPI_Wtime();
+
+        // Whether the top and bottom ghost rows are copied from shared memory rather than sent
+        bool on_node[2] = {shared && chunk->node_neighbs[0] != MPI_UNDEFINED,
+                           shared && chunk->node_neighbs[1] != MPI_UNDEFINED};
+
+        // 1. Share the borders with the neighbours, while they are in flight, but with those on the same node if they share memory...
+        if (on_node[0])
+            requests[0] = requests[1] = MPI_REQUEST_NULL;
+        else
+            post_halo(chunk, -1, 0, &requests[0]);
+
+        if (on_node[1])
+            requests[2] = requests[3] = MPI_REQUEST_NULL;
+        else
+            post_halo(chunk,  1, 0, &requests[2]);
+
+        if (strips) {
+            phase_times[PHASE_COMM] += lap(&clock);
 
-        // Evolve the current chunk
-        evolve_chunk(chunk);
+            if (shared) {
+                double wait_time = exchange_shared_halo(chunk);
+                double elapsed   = lap(&clock);
 
-        // Identify top/bottom neighbours ranks
-        int prev_rank = (chunk->rank - 1 + chunk->size) % chunk->size;
-        int next_rank = (chunk->rank + 1) % chunk->size;
+                phase_times[PHASE_WAIT] += wait_time;
+                phase_times[PHASE_COMM] += elapsed - wait_time;
+            }
+
+            wrap_frame_cols(chunk->slice, ghost, ghost + nrows, ncols, 1);
+        } else {
+            post_halo(chunk, 0, -1, &requests[4]);
+            post_halo(chunk, 0,  1, &requests[6]);
+
+            post_halo(chunk, -1, -1, &requests[8]);
+            post_halo(chunk, -1,  1, &requests[10]);
+            post_halo(chunk,  1, -1, &requests[12]);
+            post_halo(chunk,  1,  1, &requests[14]);
+
+            phase_times[PHASE_COMM] += lap(&clock);
+
+            // Interior rows need their ghost columns, whose messages are far smaller than rows on wide boards
+            MPI_Waitall(4, &requests[4], MPI_STATUSES_IGNORE);
+
+            phase_times[PHASE_WAIT] += lap(&clock);
+        }
+
+        // 2. ...evolve the interior rows
+        engine_evolve_chunk(chunk, inner_from, inner_to);
+
+        phase_times[PHASE_COMPUTE] += lap(&clock);
+
+        // 3. Evolve the other rows of the valid region, as soon as the ghost rows have arrived
+        MPI_Waitall(4, requests, MPI_STATUSES_IGNORE);
 
-        // Share ghost rows with top/bottom neighbours
-        MPI_Sendrecv(&chunk->slice[1][0], chunk->ncols, MPI_C_BOOL, prev_rank, TOP,
-                     &chunk->slice[chunk->nrows + 1][0], chunk->ncols, MPI_C_BOOL, next_rank, TOP,
-                     MPI_COMM_WORLD, &status);
+        if (!strips)
+            MPI_Waitall(8, &requests[8], MPI_STATUSES_IGNORE);
 
-        MPI_Sendrecv(&chunk->slice[chunk->nrows][0], chunk->ncols, MPI_C_BOOL, next_rank, BOTTOM,
-                     &chunk->slice[0][0], chunk->ncols, MPI_C_BOOL, prev_rank, BOTTOM,
-                     MPI_COMM_WORLD, &status);
+        phase_times[PHASE_WAIT] += lap(&clock);
 
-        MPI_Barrier(MPI_COMM_WORLD);
+        if (chunk->wire == WIRE_PACKED) {
+            if (!on_node[0])
+                unpack_halo(chunk, -1);
 
-        if (chunk->rank == 0) {
-            // Track the end time
-            gettimeofday(&gend, NULL);
+            if (!on_node[1])
+                unpack_halo(chunk,  1);
 
-            cur_gene_time = elapsed_wtime(gstart, gend);
-            tot_gene_time += cur_gene_time;
+            phase_times[PHASE_COMM] += lap(&clock);
         }
 
+        if (strips) {
+            wrap_frame_cols(chunk->slice, 0, ghost, ncols, 1);
+            wrap_frame_cols(chunk->slice, ghost + nrows, tot_rows, ncols, 1);
+        }
+
+        engine_evolve_chunk(chunk, 1, inner_from);
+        engine_evolve_chunk(chunk, inner_to, tot_rows - 1);
+
+        swap_grids(&chunk->slice, &chunk->next_slice);
+
+        // The next generation overwrites the slice the neighbours on the same node copy their ghost rows from
+        if (shared && steps > 1) {
+            phase_times[PHASE_COMPUTE] += lap(&clock);
+
+            wait_shared_neighbs(chunk, SHARED_CONSUMED, chunk->blocks + 1);
+
+            phase_times[PHASE_WAIT] += lap(&clock);
+        }
+
+        // 4. Evolve the shrinking valid region for the other generations
+        for (g = 2; g <= steps; g++) {
+            wrap_frame_cols(chunk->slice, g - 1, tot_rows - g + 1, ncols, 1);
+
+            engine_evolve_chunk(chunk, g, tot_rows - g);
+
+            swap_grids(&chunk->slice, &chunk->next_slice);
+        }
+
+        if (shared)
+            complete_shared_block(chunk);
+
+        phase_times[PHASE_COMPUTE] += lap(&clock);
+
+        // Track the end time
+        cur_gene_time = (clock - gstart) * 1000.;
+        tot_gene_time += cur_gene_time;
+
         if(big) {
-            if (chunk->rank == 0)
-                printf("Generation #%d took %.5f ms on process 0\n", i, cur_gene_time);  
+            if (chunk->rank == 0) {
+                if (steps == 1)
+                    printf("Generation #%d took %.5f ms on process 0\n", i, cur_gene_time);
+                else
+                    printf("Generations #%d-#%d took %.5f ms on process 0\n", i, i + steps - 1, cur_gene_time);
+            }
 
             // If the GoL grid is large, print it (to file)
-            // only at the end of the last generation
-            if (i == timesteps - 1) {
-                display_chunk(chunk, big, tot_rows,
-                        outfile, true);
+            // only every so many generations and at the end of the last one
+            if (i + steps == timesteps
+                    || (chunk->dump > 0 && (i + steps) % chunk->dump == 0)) {
+                display_chunk(chunk, big, outfile, true);
             }
         } else {
-            display_chunk(chunk, big, tot_rows,
-                    outfile, true);
+            display_chunk(chunk, big, outfile, true);
         }
+
+        // 5. Check the load balance every so many generations, but the last ones
+        if (chunk->rebalance > 0
+                && i + steps - balanced_at >= chunk->rebalance
+                && i + steps < timesteps) {
+            double rstart = MPI_Wtime();
+
+            rebalance_chunk(chunk, phase_times[PHASE_COMPUTE] - balanced_cost, i + steps);
+
+            tot_gene_time += (MPI_Wtime() - rstart) * 1000.;
+
+            balanced_at   = i + steps;
+            balanced_cost = phase_times[PHASE_COMPUTE];
+        }
+
+        // 6. Write a checkpoint in the background, every so many generations
+        if (chunk->checkpoint > 0 && (i + steps) % chunk->checkpoint == 0)
+            save_chunk_checkpoint(chunk, life, i + steps);
     }
 
+    wait_chunk_checkpoint(chunk, outfile);
+
     if (chunk->rank == 0)
         printf("\nEvolved GoL's grid for %d generations - ETA: %.5f ms\n",
                 timesteps, tot_gene_time);
 
+    reduce_timings(chunk, phase_times);
+    reduce_writer(chunk);
+
     return tot_gene_time;
 }
 
-void evolve_chunk(chunk_t *chunk) {
-    int x, y, i, j, r, c;
+/**
+ * Evolve the rows in [from, to) of a chunk, following GoL rules, once its ghost cells are up to date. Rows are written to the next slice.
+ */
+void evolve_chunk(chunk_t *chunk, int from, int to) {
+    int x, y, i, j;
 
     int alive_neighbs; // # of alive neighbours
 
     int ncols = chunk->ncols;
-    int nrows = chunk->nrows;
  
-    // 1. Evolve every cell in the chunk
+    // 1. Evolve every cell in the given rows, which never include ghost rows
     #ifdef _OPENMP
-    #pragma omp parallel for private(alive_neighbs, y, i, j, r, c)
+    #pragma omp parallel for private(alive_neighbs, y, i, j)
     #endif
-    for (x = 1; x < nrows + 1; x++) // Skip ghost rows: (1, ..., nrows + 1)
+    for (x = from; x < to; x++)
         for (y = 0; y < ncols; y++) {
             alive_neighbs = 0;
 
             // 1.a Check the 3x3 neighbourhood
             for (i = x - 1; i <= x + 1; i++)
                 for (j = y - 1; j <= y + 1; j++) {
-                    /* Compute the actual row/col coordinates in the GoL chunk. */
-
-                    c = (j + ncols) % ncols;
+                    /* Neighbours beyond the chunk's borders lie in its ghost cells. */
 
                     if (!(i == x && j == y) // Skip the current cell (x, y)
-                            && chunk->slice[i][c] == ALIVE)
+                            && chunk->slice[i][j] == ALIVE)
                         alive_neighbs++;
                 }
 
@@ -206,16 +650,22 @@ void evolve_chunk(chunk_t *chunk) {
                             && chunk->slice[x][y] == ALIVE)) \
                     ? ALIVE : DEAD;
         }
-
-    // 2. Replace the old grid with the updated one
-    swap_grids(&chunk->slice, &chunk->next_slice);
 }
 
 void cleanup_chunk(chunk_t *chunk) {
-    int i;
+    engine_cleanup_chunk(chunk);
+    free_chunk(chunk);
+    free(chunk->row_starts);
+
+    close_writer(&chunk->writer);
+
+    if (chunk->out_file != MPI_FILE_NULL)
+        MPI_File_close(&chunk->out_file);
+
+    if (chunk->exchange == EXCHANGE_SHARED)
+        MPI_Comm_free(&chunk->node_comm);
 
-    free(chunk->slice);
-    free(chunk->next_slice);
+    MPI_Comm_free(&chunk->comm);
 }
 #endif
 
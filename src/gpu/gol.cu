@@ -9,22 +9,19 @@
  * Initialize all variables and structures required by GoL evolution.
  */
 void initialize(life_t *life) {
-    // 1. Initialize the random seed
-    srand(life->seed);
-
-    // 2. Check if an input file was specified in the args
+    // 1. Check if an input file was specified in the args
     // and, in that case, update ncols and nrows.
     //
     // Use defaults, if no file is present.
     FILE *input_ptr = set_grid_dimens_from_file(life);
 
-    // 3. Allocate memory for the grid
+    // 2. Allocate memory for the grid
     malloc_grid(life);
 
-    // 4. Initialize the grid with DEAD cells
+    // 3. Initialize the grid with DEAD cells
     init_empty_grid(life);
 
-    // 5. Initialize the grid with ALIVE cells...
+    // 4. Initialize the grid with ALIVE cells...
     if (input_ptr != NULL) { // ...from file, if present...
         init_from_file(life, input_ptr);
     } else {  // ...or randomly, otherwise.
@@ -247,6 +244,7 @@ void evolve(bool *gpu_grid, bool *gpu_next_grid,
 
 void cleanup(life_t *life) {  
     free(life->grid);
+    close_writer(life->writer);
 }
 
 /************************************
@@ -257,17 +255,22 @@ int main(int argc, char **argv) {
     struct timeval start, end;
 
     life_t life;
+    writer_t writer; // Writer of the output file, which outlives GoL's board to be logged
 
     gettimeofday(&start, NULL);
 
     // 1. Initialize vars from args
     parse_args(&life, argc, argv);
 
+    init_writer(&writer);
+    life.writer = &writer;
+
     FILE *input_ptr = set_grid_dimens_from_file(&life);
 
     // 2. Launch the simulation
     double cum_gene_time = game(&life);
     cleanup(&life);
+    report_writer(writer);
 
     gettimeofday(&end, NULL);
 
@@ -277,7 +280,7 @@ int main(int argc, char **argv) {
     FILE *log_ptr = init_log_file(life, 1);
 
     log_data(log_ptr, life.timesteps, cum_gene_time,
-            elapsed_prog_wtime);
+            elapsed_prog_wtime, writer);
 
     fflush(log_ptr);
     fclose(log_ptr);
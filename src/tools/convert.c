@@ -0,0 +1,171 @@
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/types.h>
+
+// Custom includes
+#include "../../include/globals.h"
+
+#include "../../include/utils/board.h"
+#include "../../include/utils/pack.h"
+#include "../../include/utils/writer.h"
+
+/*
+ * Convert GoL's boards between the full-matrix format (FM) and the binary format, one row at a time, so that boards of any size fit
+ * in a few rows of memory. The direction is told by the input file itself, i.e., binary boards start with BOARD_MAGIC.
+ */
+
+/**
+ * Print the expected usage of the tool.
+ */
+void show_usage(void) {
+    printf("\nUsage: GoL_convert INPUT OUTPUT\n\n");
+    printf("Convert a GoL board in FM format into a binary board, or the other way around. See README for either format.\n");
+    printf("Only the first board of an FM file is converted, e.g., the initial board of an output file.\n\n");
+}
+
+/**
+ * Convert a board in FM format into a binary board.
+ */
+void fm_to_board(FILE *in_ptr, FILE *out_ptr) {
+    int i, j;
+    int nrows, ncols;
+
+    char *line = NULL;
+    size_t buf_size = 0; // Size of the buffer allocated to read the line
+    ssize_t len = 0;     // Amount of characters in the read line
+
+    // The dimensions are read as a whole line, so that the leading whitespaces of the 1st row are not skipped
+    if (getline(&line, &buf_size, in_ptr) == -1
+            || sscanf(line, "%d %d", &nrows, &ncols) != 2 || nrows <= 0 || ncols <= 0) {
+        fprintf(stderr, "[*] The input file does not define GoL board's dimensions!\n");
+        exit(EXIT_FAILURE);
+    }
+
+    board_header_t header;
+
+    init_board_header(&header, nrows, ncols, 0, DEFAULT_SEED);
+
+    size_t row_words = board_row_words(ncols);
+
+    bool *row       = (bool *) malloc(sizeof(bool) * ncols);
+    uint64_t *words = (uint64_t *) calloc(row_words, sizeof(uint64_t));
+
+    if (row == NULL || words == NULL) {
+        perror("[*] Failed to allocate the row.");
+        exit(EXIT_FAILURE);
+    }
+
+    if (fwrite(&header, sizeof(board_header_t), 1, out_ptr) != 1) {
+        perror("[*] Failed to write the output file.");
+        exit(EXIT_FAILURE);
+    }
+
+    for (i = 0; i < nrows; i++) {
+        if ((len = getline(&line, &buf_size, in_ptr)) == -1) {
+            fprintf(stderr, "[*] The input file does not respect the number of rows!\n");
+            exit(EXIT_FAILURE);
+        }
+
+        // + 1 for newline char, '\n', which the last row may lack
+        if (len != ncols + 1 && !(len == ncols && line[len - 1] != '\n')) {
+            fprintf(stderr, "[*] Row #%d does not respect the number of columns!\n", i);
+            exit(EXIT_FAILURE);
+        }
+
+        for (j = 0; j < ncols; j++)
+            row[j] = line[j] == 'X' ? ALIVE : DEAD;
+
+        pack_row(row, ncols, words);
+
+        if (fwrite(words, sizeof(uint64_t), row_words, out_ptr) != row_words) {
+            perror("[*] Failed to write the output file.");
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    free(line);
+    free(row);
+    free(words);
+}
+
+/**
+ * Convert a binary board into a board in FM format.
+ */
+void board_to_fm(const char *infile, FILE *out_ptr) {
+    int64_t i;
+
+    size_t size;
+
+    const board_header_t *header = map_board(infile, &size);
+
+    if (header == NULL)
+        exit(EXIT_FAILURE);
+
+    int64_t nrows = header->nrows;
+    int64_t ncols = header->ncols;
+
+    bool *row  = (bool *) malloc(sizeof(bool) * ncols);
+    char *line = (char *) malloc(sizeof(char) * (ncols + 1));
+
+    if (row == NULL || line == NULL) {
+        perror("[*] Failed to allocate the row.");
+        exit(EXIT_FAILURE);
+    }
+
+    fprintf(out_ptr, "%ld %ld\n", (long) nrows, (long) ncols);
+
+    for (i = 0; i < nrows; i++) {
+        unpack_row(board_row(header, i), (int) ncols, row);
+
+        format_cells(row, (int) ncols, line);
+
+        line[ncols] = '\n';
+
+        // A DEAD (0, 0) cell takes a non-'X' character, see README
+        if (i == 0 && row[0] == DEAD)
+            line[0] = 'A';
+
+        if (fwrite(line, sizeof(char), ncols + 1, out_ptr) != (size_t) ncols + 1) {
+            perror("[*] Failed to write the output file.");
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    free(row);
+    free(line);
+
+    unmap_board(header, size);
+}
+
+int main(int argc, char **argv) {
+    if (argc != 3) {
+        show_usage();
+        exit(EXIT_FAILURE);
+    }
+
+    bool binary = is_board(argv[1]);
+
+    FILE *in_ptr  = fopen(argv[1], "r");
+    FILE *out_ptr = fopen(argv[2], binary ? "w" : "wb");
+
+    if (in_ptr == NULL || out_ptr == NULL) {
+        perror("[*] Failed to open the input or output file.");
+        exit(EXIT_FAILURE);
+    }
+
+    if (binary)
+        board_to_fm(argv[1], out_ptr);
+    else
+        fm_to_board(in_ptr, out_ptr);
+
+    fclose(in_ptr);
+
+    if (fclose(out_ptr) != 0) {
+        perror("[*] Failed to write the output file.");
+        exit(EXIT_FAILURE);
+    }
+
+    return 0;
+}